@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_vector.h"
+#include "../s21_vector.h"
+
+namespace {
+
+constexpr int kThreads = 8;
+constexpr int kPerThread = 100000;
+
+// Each producer appends kPerThread values tagged with its id.
+template <typename Append>
+double RunProducers(Append append) {
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreads; ++t)
+    producers.emplace_back([&append, t] {
+      for (int i = 0; i < kPerThread; ++i) append(t * kPerThread + i);
+    });
+  for (std::thread &producer : producers) producer.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return kThreads * kPerThread / elapsed.count();
+}
+
+}  // namespace
+
+TEST(ConcurrentVectorBenchmark, ParallelPushBackThroughput) {
+  s21::concurrent_vector<int> lock_free;
+  double lock_free_rate =
+      RunProducers([&lock_free](int value) { lock_free.push_back(value); });
+
+  s21::vector<int> locked;
+  std::mutex mutex;
+  double locked_rate = RunProducers([&](int value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    locked.push_back(value);
+  });
+  RecordProperty("concurrent_vector_pushes_per_second", int(lock_free_rate));
+  RecordProperty("mutex_vector_pushes_per_second", int(locked_rate));
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+
+#include "../s21_list.h"
+
+namespace {
+
+// The sort that list::sort() used to run: swap neighbours and start over.
+void RestartingBubbleSort(s21::list<int> &items) {
+  for (auto current = ++items.begin(); current != items.end();) {
+    auto previous = current;
+    --previous;
+    if (*current < *previous) {
+      std::swap(*current, *previous);
+      current = ++items.begin();
+    } else {
+      ++current;
+    }
+  }
+}
+
+template <typename Sort>
+double SortMilliseconds(std::size_t size, Sort sort) {
+  std::mt19937 random(size);
+  s21::list<int> items;
+  for (std::size_t i = 0; i < size; ++i) items.push_back(random());
+  auto start = std::chrono::steady_clock::now();
+  sort(items);
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+}  // namespace
+
+TEST(ListBenchmark, Sort) {
+  for (std::size_t size = 1000; size <= 1000000; size *= 10) {
+    double merge = SortMilliseconds(size, [](auto &items) { items.sort(); });
+    RecordProperty("merge_sort_ms_" + std::to_string(size), int(merge));
+  }
+  // The old sort is far too slow to run past a thousand elements.
+  double bubble = SortMilliseconds(1000, RestartingBubbleSort);
+  RecordProperty("bubble_sort_ms_1000", int(bubble));
+}
+
+TEST(ListBenchmark, PooledQueue) {
+  auto churn = [](auto &items) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < 100; ++round) {
+      for (int i = 0; i < 1000; ++i) items.push_back(i);
+      for (int i = 0; i < 1000; ++i) items.pop_front();
+    }
+    std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return int(elapsed.count());
+  };
+  s21::list<int> heap;
+  s21::list<int, s21::pool_allocator<int>> pooled;
+  RecordProperty("heap_list_us", churn(heap));
+  RecordProperty("pooled_list_us", churn(pooled));
+}
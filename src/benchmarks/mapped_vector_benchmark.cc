@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "../s21_mapped_vector.h"
+#include "../s21_vector.h"
+
+namespace {
+
+struct Record {
+  std::uint64_t id;
+  double price;
+  std::int32_t quantity;
+};
+
+}  // namespace
+
+TEST(MappedVectorBenchmark, AttachAndReload) {
+  constexpr std::size_t kRecords = 2000000;
+  std::string path = ::testing::TempDir() + "s21_mapped_vector_benchmark_" +
+                     std::to_string(getpid());
+  unlink(path.c_str());
+  {
+    s21::mapped_vector<Record> v(path);
+    v.resize_for_overwrite(kRecords);
+    for (std::size_t i = 0; i < kRecords; ++i) v[i] = {i, i * 0.25, 1};
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  s21::mapped_vector<const Record> attached(path);
+  std::chrono::duration<double, std::milli> attach =
+      std::chrono::steady_clock::now() - start;
+
+  // Reads the records past the 64-byte header into memory.
+  start = std::chrono::steady_clock::now();
+  s21::vector<Record> reloaded;
+  reloaded.resize_for_overwrite(kRecords);
+  std::ifstream(path, std::ios::binary)
+      .seekg(64)
+      .read(reinterpret_cast<char *>(reloaded.data()),
+            kRecords * sizeof(Record));
+  std::chrono::duration<double, std::milli> reload =
+      std::chrono::steady_clock::now() - start;
+
+  RecordProperty("attach_us", int(attach.count() * 1000));
+  RecordProperty("reload_us", int(reload.count() * 1000));
+  EXPECT_EQ(attached[kRecords - 1].id, reloaded[kRecords - 1].id);
+  unlink(path.c_str());
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "../s21_list.h"
+#include "../s21_unrolled_list.h"
+#include "../s21_vector.h"
+
+TEST(UnrolledListBenchmark, Iteration) {
+  constexpr int kElements = 1000000;
+  constexpr int kPasses = 20;
+  s21::unrolled_list<int> unrolled;
+  s21::list<int> linked;
+  s21::vector<int> vector;
+  for (int i = 0; i < kElements; ++i) {
+    // Alternate ends, so that the nodes of the linked list are spread out.
+    if (i % 2) {
+      unrolled.push_back(i);
+      linked.push_back(i);
+    } else {
+      unrolled.push_front(i);
+      linked.push_front(i);
+    }
+    vector.push_back(i);
+  }
+
+  auto time = [](const auto &container) {
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kPasses; ++pass)
+      for (int value : container) sum += value;
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(sum, kPasses * (kElements - 1LL) * kElements / 2);
+    return elapsed.count();
+  };
+  double unrolled_ms = time(unrolled);
+  double linked_ms = time(linked);
+  double vector_ms = time(vector);
+  RecordProperty("unrolled_list_us", int(unrolled_ms * 1000));
+  RecordProperty("list_us", int(linked_ms * 1000));
+  RecordProperty("vector_us", int(vector_ms * 1000));
+}
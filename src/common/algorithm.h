@@ -0,0 +1,81 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_ALGORITHM_H_
+#define CPP2_S21_CONTAINERS_COMMON_ALGORITHM_H_
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// constexpr stand-ins for the std algorithms that only became constexpr in
+// C++20, so that tables held in s21::array can be built at compile time.
+// They live in a namespace of their own: in namespace s21, argument
+// dependent lookup would make unqualified std calls on s21 types ambiguous.
+namespace s21 {
+namespace constexpr_algo {
+
+template <typename T>
+constexpr void swap_values(T &a, T &b) noexcept(
+    std::is_nothrow_move_constructible_v<T> &&
+    std::is_nothrow_move_assignable_v<T>) {
+  T tmp = std::move(a);
+  a = std::move(b);
+  b = std::move(tmp);
+}
+
+template <typename ForwardIt, typename T>
+constexpr void fill(ForwardIt first, ForwardIt last, const T &value) {
+  for (; first != last; ++first) *first = value;
+}
+
+template <typename InputIt, typename OutputIt, typename UnaryOp>
+constexpr OutputIt transform(InputIt first, InputIt last, OutputIt out,
+                             UnaryOp op) {
+  for (; first != last; ++first, ++out) *out = op(*first);
+  return out;
+}
+
+template <typename InputIt1, typename InputIt2, typename OutputIt,
+          typename BinaryOp>
+constexpr OutputIt transform(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                             OutputIt out, BinaryOp op) {
+  for (; first1 != last1; ++first1, ++first2, ++out)
+    *out = op(*first1, *first2);
+  return out;
+}
+
+}  // namespace constexpr_algo
+
+namespace detail {
+
+template <typename RandomIt, typename Compare>
+constexpr void SiftDown(RandomIt first, std::ptrdiff_t root,
+                        std::ptrdiff_t size, Compare &comp) {
+  for (std::ptrdiff_t child = 2 * root + 1; child < size;
+       root = child, child = 2 * root + 1) {
+    if (child + 1 < size && comp(first[child], first[child + 1])) ++child;
+    if (!comp(first[root], first[child])) return;
+    constexpr_algo::swap_values(first[root], first[child]);
+  }
+}
+
+}  // namespace detail
+
+namespace constexpr_algo {
+
+// Heapsort: O(n log n) without recursion or extra memory, which keeps the
+// constant evaluator's step count low. Not stable, like std::sort.
+template <typename RandomIt, typename Compare = std::less<>>
+constexpr void sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+  std::ptrdiff_t size = last - first;
+  for (std::ptrdiff_t root = size / 2; root-- > 0;)
+    detail::SiftDown(first, root, size, comp);
+  while (size > 1) {
+    swap_values(first[0], first[--size]);
+    detail::SiftDown(first, 0, size, comp);
+  }
+}
+
+}  // namespace constexpr_algo
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_ALGORITHM_H_
@@ -0,0 +1,103 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_ALIGNED_H_
+#define CPP2_S21_CONTAINERS_COMMON_ALIGNED_H_
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Size of a cache line on the targets we care about, the usual padding for
+// data written by different threads.
+inline constexpr std::size_t kCacheLineBytes = 64;
+
+namespace detail {
+
+template <std::size_t Align>
+inline constexpr bool kIsValidAlignment = Align != 0 && !(Align & (Align - 1));
+
+}  // namespace detail
+
+// Allocator whose blocks start on an Align-byte boundary, e.g. 32 or 64 for
+// aligned AVX loads. Align may not be weaker than the natural alignment of T.
+template <typename T, std::size_t Align = kCacheLineBytes>
+class aligned_allocator {
+  static_assert(detail::kIsValidAlignment<Align>,
+                "s21::aligned_allocator Alignment must be a power of two");
+  static_assert(Align >= alignof(T),
+                "s21::aligned_allocator Alignment can't be weaker than the "
+                "natural alignment of T");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using is_always_equal = std::true_type;
+
+  static constexpr std::size_t alignment = Align;
+
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Align>;
+  };
+
+  aligned_allocator() noexcept = default;
+
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+
+  T *allocate(size_type count) {
+    if (count > std::numeric_limits<size_type>::max() / sizeof(T))
+      throw std::bad_array_new_length();
+    return static_cast<T *>(
+        ::operator new(count * sizeof(T), std::align_val_t(Align)));
+  }
+
+  void deallocate(T *ptr, size_type) noexcept {
+    ::operator delete(ptr, std::align_val_t(Align));
+  }
+};
+
+template <typename T, typename U, std::size_t Align>
+bool operator==(const aligned_allocator<T, Align> &,
+                const aligned_allocator<U, Align> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U, std::size_t Align>
+bool operator!=(const aligned_allocator<T, Align> &,
+                const aligned_allocator<U, Align> &) noexcept {
+  return false;
+}
+
+// A T that owns a whole Align-byte slot: its address is aligned and its size
+// rounded up, so neighbouring slots of a container never share a cache line.
+// Meant for per-thread counters and the like.
+template <typename T, std::size_t Align = kCacheLineBytes>
+struct alignas(Align) cache_padded {
+  static_assert(detail::kIsValidAlignment<Align>,
+                "s21::cache_padded Alignment must be a power of two");
+
+  T value{};
+
+  constexpr cache_padded() = default;
+
+  template <typename... Args>
+  constexpr explicit cache_padded(std::in_place_t, Args &&...args)
+      : value(std::forward<Args>(args)...) {}
+
+  constexpr cache_padded(const T &item) : value(item) {}
+
+  constexpr cache_padded(T &&item) : value(std::move(item)) {}
+
+  constexpr T &operator*() noexcept { return value; }
+  constexpr const T &operator*() const noexcept { return value; }
+  constexpr T *operator->() noexcept { return &value; }
+  constexpr const T *operator->() const noexcept { return &value; }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_ALIGNED_H_
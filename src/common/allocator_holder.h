@@ -0,0 +1,29 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_ALLOCATOR_HOLDER_H_
+#define CPP2_S21_CONTAINERS_COMMON_ALLOCATOR_HOLDER_H_
+
+#include <utility>
+
+namespace s21 {
+namespace detail {
+
+// Keeps a container's allocator as a base class, so that a stateless one
+// such as std::allocator takes no space in the container.
+template <typename Allocator>
+class AllocatorHolder : private Allocator {
+ public:
+  AllocatorHolder() = default;
+
+  explicit AllocatorHolder(const Allocator &alloc) : Allocator(alloc) {}
+
+  explicit AllocatorHolder(Allocator &&alloc) noexcept
+      : Allocator(std::move(alloc)) {}
+
+  Allocator &Alloc() noexcept { return *this; }
+
+  const Allocator &Alloc() const noexcept { return *this; }
+};
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_ALLOCATOR_HOLDER_H_
@@ -0,0 +1,131 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_CHECK_POLICY_H_
+#define CPP2_S21_CONTAINERS_COMMON_CHECK_POLICY_H_
+
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+
+enum class access_error { none, out_of_range, empty };
+
+// What a checked access returns under check::expected: a reference to the
+// element or the reason there is none.
+template <typename Ref>
+class access_result {
+ public:
+  using value_type = std::remove_reference_t<Ref>;
+
+  constexpr access_result(Ref ref) noexcept : item_(&ref) {}
+  constexpr access_result(access_error error) noexcept : error_(error) {}
+
+  constexpr bool has_value() const noexcept { return item_ != nullptr; }
+  constexpr explicit operator bool() const noexcept { return has_value(); }
+  constexpr access_error error() const noexcept { return error_; }
+
+  // Unchecked, like dereferencing an std::optional.
+  constexpr Ref operator*() const noexcept { return *item_; }
+  constexpr value_type *operator->() const noexcept { return item_; }
+
+  constexpr Ref value() const {
+    if (!item_) throw std::out_of_range("s21::access_result Holds no value");
+    return *item_;
+  }
+
+  constexpr Ref value_or(Ref fallback) const noexcept {
+    return item_ ? *item_ : fallback;
+  }
+
+ private:
+  value_type *item_ = nullptr;
+  access_error error_ = access_error::none;
+};
+
+// Check policies decide what at(), front() and back() of vector, array and
+// list do about an invalid access. A container runs
+//   if (!Policy::Check(valid)) return Policy::Fail<Ref>(error, message);
+//   return Policy::Ok<Ref>(element);
+// and returns Policy::result<Ref> to its caller.
+namespace check {
+
+// Throws std::out_of_range, the default.
+struct throwing {
+  template <typename Ref>
+  using result = Ref;
+
+  static constexpr bool Check(bool valid) noexcept { return valid; }
+
+  template <typename Ref>
+  [[noreturn]] static Ref Fail(access_error, const char *message) {
+    throw std::out_of_range(message);
+  }
+
+  template <typename Ref>
+  static constexpr Ref Ok(Ref ref) noexcept {
+    return ref;
+  }
+};
+
+// assert()s in debug builds and compiles to a plain access under NDEBUG.
+struct debug {
+  template <typename Ref>
+  using result = Ref;
+
+  static constexpr bool Check([[maybe_unused]] bool valid) noexcept {
+    assert(valid && "s21 container accessed out of range");
+    return true;
+  }
+
+  template <typename Ref>
+  [[noreturn]] static Ref Fail(access_error, const char *) noexcept {
+    std::abort();
+  }
+
+  template <typename Ref>
+  static constexpr Ref Ok(Ref ref) noexcept {
+    return ref;
+  }
+};
+
+// No checks at all, for hot paths that have validated their indices.
+struct unchecked {
+  template <typename Ref>
+  using result = Ref;
+
+  static constexpr bool Check(bool) noexcept { return true; }
+
+  template <typename Ref>
+  [[noreturn]] static Ref Fail(access_error, const char *) noexcept {
+    std::abort();
+  }
+
+  template <typename Ref>
+  static constexpr Ref Ok(Ref ref) noexcept {
+    return ref;
+  }
+};
+
+// Never throws: accesses return an access_result carrying an error code.
+struct expected {
+  template <typename Ref>
+  using result = access_result<Ref>;
+
+  static constexpr bool Check(bool valid) noexcept { return valid; }
+
+  template <typename Ref>
+  static constexpr access_result<Ref> Fail(access_error error,
+                                           const char *) noexcept {
+    return access_result<Ref>(error);
+  }
+
+  template <typename Ref>
+  static constexpr access_result<Ref> Ok(Ref ref) noexcept {
+    return access_result<Ref>(ref);
+  }
+};
+
+}  // namespace check
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_CHECK_POLICY_H_
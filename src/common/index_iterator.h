@@ -0,0 +1,125 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_INDEX_ITERATOR_H_
+#define CPP2_S21_CONTAINERS_COMMON_INDEX_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace s21 {
+namespace detail {
+
+// Random access iterator for containers whose elements are produced on the
+// fly by operator[] (rows of soa_vector, string_views of varlen_vector). It
+// is a container pointer plus an index, so it yields Reference by value.
+template <typename Container, typename Reference>
+class IndexIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename std::remove_const_t<Container>::value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = Reference;
+  using pointer = void;
+
+  IndexIterator() noexcept = default;
+
+  IndexIterator(Container *container, std::size_t pos) noexcept
+      : container_(container), pos_(pos) {}
+
+  reference operator*() const { return (*container_)[pos_]; }
+
+  reference operator[](difference_type n) const {
+    return (*container_)[pos_ + n];
+  }
+
+  IndexIterator &operator++() noexcept {
+    ++pos_;
+    return *this;
+  }
+
+  IndexIterator operator++(int) noexcept {
+    IndexIterator old = *this;
+    ++pos_;
+    return old;
+  }
+
+  IndexIterator &operator--() noexcept {
+    --pos_;
+    return *this;
+  }
+
+  IndexIterator operator--(int) noexcept {
+    IndexIterator old = *this;
+    --pos_;
+    return old;
+  }
+
+  IndexIterator &operator+=(difference_type n) noexcept {
+    pos_ += n;
+    return *this;
+  }
+
+  IndexIterator &operator-=(difference_type n) noexcept {
+    pos_ -= n;
+    return *this;
+  }
+
+  friend IndexIterator operator+(IndexIterator it,
+                                  difference_type n) noexcept {
+    return it += n;
+  }
+
+  friend IndexIterator operator+(difference_type n,
+                                  IndexIterator it) noexcept {
+    return it += n;
+  }
+
+  friend IndexIterator operator-(IndexIterator it,
+                                  difference_type n) noexcept {
+    return it -= n;
+  }
+
+  friend difference_type operator-(const IndexIterator &a,
+                                   const IndexIterator &b) noexcept {
+    return difference_type(a.pos_) - difference_type(b.pos_);
+  }
+
+  friend bool operator==(const IndexIterator &a,
+                         const IndexIterator &b) noexcept {
+    return a.pos_ == b.pos_;
+  }
+
+  friend bool operator!=(const IndexIterator &a,
+                         const IndexIterator &b) noexcept {
+    return a.pos_ != b.pos_;
+  }
+
+  friend bool operator<(const IndexIterator &a,
+                        const IndexIterator &b) noexcept {
+    return a.pos_ < b.pos_;
+  }
+
+  friend bool operator>(const IndexIterator &a,
+                        const IndexIterator &b) noexcept {
+    return a.pos_ > b.pos_;
+  }
+
+  friend bool operator<=(const IndexIterator &a,
+                         const IndexIterator &b) noexcept {
+    return a.pos_ <= b.pos_;
+  }
+
+  friend bool operator>=(const IndexIterator &a,
+                         const IndexIterator &b) noexcept {
+    return a.pos_ >= b.pos_;
+  }
+
+ private:
+  Container *container_ = nullptr;
+  std::size_t pos_ = 0;
+};
+
+}  // namespace detail
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_INDEX_ITERATOR_H_
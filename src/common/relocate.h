@@ -0,0 +1,93 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_RELOCATE_H_
+#define CPP2_S21_CONTAINERS_COMMON_RELOCATE_H_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+
+// Types that can be moved around as raw bytes: the bulk paths below turn into
+// a single memcpy/memmove for them instead of an element by element loop.
+template <typename T>
+inline constexpr bool kIsTriviallyRelocatable = std::is_trivially_copyable_v<T>;
+
+// Copies [first, last) over live or raw slots at dest (no overlap).
+template <typename T>
+void CopyElements(const T *first, const T *last, T *dest) {
+  if constexpr (kIsTriviallyRelocatable<T>) {
+    if (first != last)
+      std::memcpy(static_cast<void *>(dest), first,
+                  (last - first) * sizeof(T));
+  } else {
+    std::copy(first, last, dest);
+  }
+}
+
+// Move-assigns [first, last) over live slots at dest (no overlap).
+template <typename T>
+void MoveElements(T *first, T *last, T *dest) {
+  if constexpr (kIsTriviallyRelocatable<T>) {
+    CopyElements<T>(first, last, dest);
+  } else {
+    std::move(first, last, dest);
+  }
+}
+
+// Shifts [first, last) inside one buffer so that it starts at dest. Ranges may
+// overlap, every destination slot must already be live unless T is trivially
+// relocatable.
+template <typename T>
+void ShiftElements(T *first, T *last, T *dest) {
+  if constexpr (kIsTriviallyRelocatable<T>) {
+    if (first != last)
+      std::memmove(static_cast<void *>(dest), first,
+                   (last - first) * sizeof(T));
+  } else if (dest < first) {
+    std::move(first, last, dest);
+  } else {
+    std::move_backward(first, last, dest + (last - first));
+  }
+}
+
+template <typename Alloc, typename T>
+void Destroy(Alloc &alloc, T *first, T *last) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>)
+    for (; first != last; ++first)
+      std::allocator_traits<Alloc>::destroy(alloc, first);
+}
+
+// Constructs [first, last) into raw memory at dest, leaving the sources live.
+// Non-trivial types are moved only if that can't throw and copied otherwise,
+// so on exception the source range is untouched and nothing leaks.
+template <typename Alloc, typename T>
+void UninitializedMove(Alloc &alloc, T *first, T *last, T *dest) {
+  if constexpr (kIsTriviallyRelocatable<T>) {
+    CopyElements<T>(first, last, dest);
+  } else {
+    T *current = dest;
+    try {
+      for (; first != last; ++first, ++current)
+        std::allocator_traits<Alloc>::construct(alloc, current,
+                                                std::move_if_noexcept(*first));
+    } catch (...) {
+      Destroy(alloc, dest, current);
+      throw;
+    }
+  }
+}
+
+// Moves [first, last) into raw memory at dest and destroys the sources.
+template <typename Alloc, typename T>
+void Relocate(Alloc &alloc, T *first, T *last, T *dest) {
+  UninitializedMove(alloc, first, last, dest);
+  Destroy(alloc, first, last);
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_RELOCATE_H_
@@ -0,0 +1,306 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_SIMD_H_
+#define CPP2_S21_CONTAINERS_COMMON_SIMD_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Scan kernels behind the find/count/min/max/sum members of s21::vector and
+// s21::array. On x86-64 with GCC, 32 and 64-bit arithmetic types are scanned
+// with SSE2, AVX2 or AVX-512, picked once at runtime from what the CPU
+// supports. Everything else, and the kScalar level, uses plain loops.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__)
+#define S21_SIMD_X86 1
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+namespace detail {
+namespace simd {
+
+template <typename T>
+inline constexpr bool kVectorizable =
+    S21_SIMD_X86 && std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 4 || sizeof(T) == 8);
+
+// Sums are accumulated in 64 bits: integers can't overflow as easily and
+// floats lose less precision. The lane order differs from a plain loop, so
+// floating point sums may differ from it in the last bits.
+template <typename T, bool = std::is_arithmetic_v<T>>
+struct SumOf {
+  using type = T;
+};
+
+template <typename T>
+struct SumOf<T, true> {
+  using type = std::conditional_t<
+      std::is_floating_point_v<T>, double,
+      std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+};
+
+template <typename T>
+using SumType = typename SumOf<T>::type;
+
+enum class Level { kScalar, kSse2, kAvx2, kAvx512 };
+
+// Widest instruction set both the build and the CPU support.
+inline Level DetectLevel() {
+#if S21_SIMD_X86
+  static const Level level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return Level::kAvx512;
+    if (__builtin_cpu_supports("avx2")) return Level::kAvx2;
+    return Level::kSse2;
+  }();
+  return level;
+#else
+  return Level::kScalar;
+#endif
+}
+
+// Instruction set the scans dispatch to, DetectLevel() unless a ScopedLevel
+// lowered it.
+inline Level &ActiveLevel() noexcept {
+  static Level level = DetectLevel();
+  return level;
+}
+
+// Makes the scans run at a lower level while it lives, so that tests reach
+// the kernels the CPU would not pick. Levels the CPU can't run are capped
+// at DetectLevel(). Not thread safe, meant for tests only.
+class ScopedLevel {
+ public:
+  explicit ScopedLevel(Level level) : saved_(ActiveLevel()) {
+    ActiveLevel() = std::min(level, DetectLevel());
+  }
+
+  ScopedLevel(const ScopedLevel &) = delete;
+  ScopedLevel &operator=(const ScopedLevel &) = delete;
+
+  ~ScopedLevel() { ActiveLevel() = saved_; }
+
+ private:
+  Level saved_;
+};
+
+#if S21_SIMD_X86
+
+template <typename T, std::size_t Bytes>
+struct VectorOf {
+  typedef T type __attribute__((vector_size(Bytes)));
+};
+
+template <typename T, std::size_t Bytes>
+using Vector = typename VectorOf<T, Bytes>::type;
+
+// The kernels are written once for a register width of Bytes and forced
+// inline into per-ISA wrappers, so vectors never cross a call boundary and
+// GCC's warnings about the vector ABI do not apply.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#define S21_SIMD_INLINE inline __attribute__((always_inline))
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE Vector<T, Bytes> Load(const T *data) {
+  Vector<T, Bytes> result;
+  __builtin_memcpy(&result, data, Bytes);
+  return result;
+}
+
+template <typename Mask>
+S21_SIMD_INLINE bool AnyTrue(const Mask &mask) {
+  using Words = Vector<std::uint64_t, sizeof(Mask)>;
+  Words words = reinterpret_cast<Words>(mask);
+  std::uint64_t any = 0;
+  for (std::size_t i = 0; i < sizeof(Mask) / 8; ++i) any |= words[i];
+  return any != 0;
+}
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE std::size_t FindKernel(const T *data, std::size_t size,
+                                       T value) {
+  constexpr std::size_t kLanes = Bytes / sizeof(T);
+  const Vector<T, Bytes> needle = Vector<T, Bytes>{} + value;
+  std::size_t i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+    if (AnyTrue(Load<T, Bytes>(data + i) == needle)) break;
+  for (; i < size; ++i)
+    if (data[i] == value) return i;
+  return size;
+}
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE std::size_t CountKernel(const T *data, std::size_t size,
+                                        T value) {
+  constexpr std::size_t kLanes = Bytes / sizeof(T);
+  // Matching lanes compare to -1, so subtracting masks counts them. Lanes
+  // are flushed before a 32-bit counter could overflow.
+  constexpr std::size_t kFlushEvery = std::size_t(1) << 30;
+  const Vector<T, Bytes> needle = Vector<T, Bytes>{} + value;
+  using Mask = decltype(needle == needle);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  while (i + kLanes <= size) {
+    Mask lanes = Mask{};
+    for (std::size_t step = 0; step < kFlushEvery && i + kLanes <= size;
+         ++step, i += kLanes)
+      lanes -= Load<T, Bytes>(data + i) == needle;
+    for (std::size_t lane = 0; lane < kLanes; ++lane) count += lanes[lane];
+  }
+  for (; i < size; ++i) count += data[i] == value;
+  return count;
+}
+
+// Returns the smallest (Less) or largest value of a non-empty range.
+template <typename T, std::size_t Bytes, bool Less>
+S21_SIMD_INLINE T ExtremumKernel(const T *data, std::size_t size) {
+  constexpr std::size_t kLanes = Bytes / sizeof(T);
+  T best = data[0];
+  std::size_t i = 0;
+  if (size >= kLanes) {
+    Vector<T, Bytes> lanes = Vector<T, Bytes>{} + best;
+    for (; i + kLanes <= size; i += kLanes) {
+      Vector<T, Bytes> items = Load<T, Bytes>(data + i);
+      if constexpr (Less)
+        lanes = items < lanes ? items : lanes;
+      else
+        lanes = items > lanes ? items : lanes;
+    }
+    for (std::size_t lane = 0; lane < kLanes; ++lane)
+      if (Less ? lanes[lane] < best : lanes[lane] > best) best = lanes[lane];
+  }
+  for (; i < size; ++i)
+    if (Less ? data[i] < best : data[i] > best) best = data[i];
+  return best;
+}
+
+template <typename T, std::size_t Bytes>
+S21_SIMD_INLINE SumType<T> SumKernel(const T *data, std::size_t size) {
+  constexpr std::size_t kLanes = Bytes / sizeof(T);
+  using Wide = Vector<SumType<T>, kLanes * sizeof(SumType<T>)>;
+  Wide lanes = Wide{};
+  std::size_t i = 0;
+  for (; i + kLanes <= size; i += kLanes)
+    lanes += __builtin_convertvector(Load<T, Bytes>(data + i), Wide);
+  SumType<T> sum = 0;
+  for (std::size_t lane = 0; lane < kLanes; ++lane) sum += lanes[lane];
+  for (; i < size; ++i) sum += data[i];
+  return sum;
+}
+
+#define S21_SIMD_DEFINE_LEVEL(Suffix, Target, Bytes)                          \
+  template <typename T>                                                       \
+  __attribute__((target(Target))) std::size_t Find##Suffix(                   \
+      const T *data, std::size_t size, T value) {                             \
+    return FindKernel<T, Bytes>(data, size, value);                           \
+  }                                                                           \
+  template <typename T>                                                       \
+  __attribute__((target(Target))) std::size_t Count##Suffix(                  \
+      const T *data, std::size_t size, T value) {                             \
+    return CountKernel<T, Bytes>(data, size, value);                          \
+  }                                                                           \
+  template <typename T>                                                       \
+  __attribute__((target(Target))) T Min##Suffix(const T *data,                \
+                                                std::size_t size) {           \
+    return ExtremumKernel<T, Bytes, true>(data, size);                        \
+  }                                                                           \
+  template <typename T>                                                       \
+  __attribute__((target(Target))) T Max##Suffix(const T *data,                \
+                                                std::size_t size) {           \
+    return ExtremumKernel<T, Bytes, false>(data, size);                       \
+  }                                                                           \
+  template <typename T>                                                       \
+  __attribute__((target(Target))) SumType<T> Sum##Suffix(const T *data,       \
+                                                         std::size_t size) {  \
+    return SumKernel<T, Bytes>(data, size);                                   \
+  }
+
+S21_SIMD_DEFINE_LEVEL(Sse2, "sse2", 16)
+S21_SIMD_DEFINE_LEVEL(Avx2, "avx2", 32)
+S21_SIMD_DEFINE_LEVEL(Avx512, "avx512f", 64)
+
+#undef S21_SIMD_DEFINE_LEVEL
+#undef S21_SIMD_INLINE
+#pragma GCC diagnostic pop
+
+#define S21_SIMD_DISPATCH(Kernel, ...)    \
+  switch (ActiveLevel()) {                \
+    case Level::kAvx512:                  \
+      return Kernel##Avx512(__VA_ARGS__); \
+    case Level::kAvx2:                    \
+      return Kernel##Avx2(__VA_ARGS__);   \
+    case Level::kSse2:                    \
+      return Kernel##Sse2(__VA_ARGS__);   \
+    default:                              \
+      break;                              \
+  }
+
+#else
+
+#define S21_SIMD_DISPATCH(Kernel, ...) {}
+
+#endif  // S21_SIMD_X86
+
+template <typename T>
+T MinValue(const T *data, std::size_t size) {
+  if constexpr (kVectorizable<T>) S21_SIMD_DISPATCH(Min, data, size)
+  return *std::min_element(data, data + size);
+}
+
+template <typename T>
+T MaxValue(const T *data, std::size_t size) {
+  if constexpr (kVectorizable<T>) S21_SIMD_DISPATCH(Max, data, size)
+  return *std::max_element(data, data + size);
+}
+
+// Index of the first element equal to value, or size.
+template <typename T>
+std::size_t Find(const T *data, std::size_t size, const T &value) {
+  if constexpr (kVectorizable<T>) S21_SIMD_DISPATCH(Find, data, size, value)
+  return std::find(data, data + size, value) - data;
+}
+
+template <typename T>
+std::size_t Count(const T *data, std::size_t size, const T &value) {
+  if constexpr (kVectorizable<T>) S21_SIMD_DISPATCH(Count, data, size, value)
+  return std::count(data, data + size, value);
+}
+
+// Index of the first smallest element of a non-empty range.
+template <typename T>
+std::size_t MinIndex(const T *data, std::size_t size) {
+  if constexpr (kVectorizable<T>) {
+    // Unordered values (NaN) match nothing, std::min_element keeps the first.
+    std::size_t index = Find(data, size, MinValue(data, size));
+    return index == size ? 0 : index;
+  }
+  return std::min_element(data, data + size) - data;
+}
+
+// Index of the first largest element of a non-empty range.
+template <typename T>
+std::size_t MaxIndex(const T *data, std::size_t size) {
+  if constexpr (kVectorizable<T>) {
+    std::size_t index = Find(data, size, MaxValue(data, size));
+    return index == size ? 0 : index;
+  }
+  return std::max_element(data, data + size) - data;
+}
+
+template <typename T>
+SumType<T> Sum(const T *data, std::size_t size) {
+  if constexpr (kVectorizable<T>) S21_SIMD_DISPATCH(Sum, data, size)
+  SumType<T> sum{};
+  for (std::size_t i = 0; i < size; ++i) sum += data[i];
+  return sum;
+}
+
+#undef S21_SIMD_DISPATCH
+
+}  // namespace simd
+}  // namespace detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_SIMD_H_
@@ -0,0 +1,63 @@
+#ifndef CPP2_S21_CONTAINERS_COMMON_SPAN_H_
+#define CPP2_S21_CONTAINERS_COMMON_SPAN_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+
+// Non-owning view of a contiguous run of elements, a small C++17 stand-in
+// for std::span. It can't change the number of elements it looks at.
+template <typename T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using reference = T &;
+  using iterator = T *;
+  using size_type = std::size_t;
+
+  constexpr span() noexcept = default;
+
+  constexpr span(T *data, size_type size) noexcept
+      : data_(data), size_(size) {}
+
+  // span<T> converts to span<const T>.
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr span(const span<U> &other) noexcept
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr T *data() const noexcept { return data_; }
+
+  constexpr size_type size() const noexcept { return size_; }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr reference operator[](size_type pos) const noexcept {
+    return data_[pos];
+  }
+
+  constexpr reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range("s21::span::at The index is out of range");
+    return data_[pos];
+  }
+
+  constexpr iterator begin() const noexcept { return data_; }
+
+  constexpr iterator end() const noexcept { return data_ + size_; }
+
+  constexpr span subspan(size_type offset, size_type count) const noexcept {
+    return span(data_ + offset, count);
+  }
+
+ private:
+  T *data_ = nullptr;
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_COMMON_SPAN_H_
@@ -0,0 +1,260 @@
+#ifndef CPP2_S21_CONTAINERS_LIST_POOL_ALLOCATOR_H_
+#define CPP2_S21_CONTAINERS_LIST_POOL_ALLOCATOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "../common/aligned.h"
+
+namespace s21 {
+namespace detail {
+
+// Slab pool shared by the copies of an s21::pool_allocator. It hands out
+// fixed-size slots carved from chunks of cache lines that come from
+// ByteAllocator. Freed slots go on a free list and are handed out again
+// last in, first out, while they are still in the cache. Chunks are only
+// returned when the last allocator referring to the pool goes away.
+template <typename ByteAllocator>
+class SlabPool {
+  struct alignas(kCacheLineBytes) Line {
+    unsigned char bytes[kCacheLineBytes];
+  };
+
+  struct Chunk {
+    Chunk *next;
+    std::size_t lines;
+  };
+
+  struct FreeSlot {
+    FreeSlot *next;
+  };
+
+  using line_allocator = typename std::allocator_traits<
+      ByteAllocator>::template rebind_alloc<Line>;
+  using line_traits = std::allocator_traits<line_allocator>;
+  using self_allocator = typename std::allocator_traits<
+      ByteAllocator>::template rebind_alloc<SlabPool>;
+  using self_traits = std::allocator_traits<self_allocator>;
+
+  // Chunks start small, so that a pool behind a short list stays small,
+  // and double up to this size.
+  static constexpr std::size_t kFirstChunkBytes = 4 * kCacheLineBytes;
+  static constexpr std::size_t kMaxChunkBytes = std::size_t(1) << 16;
+
+ public:
+  static SlabPool *Create(const ByteAllocator &upstream) {
+    self_allocator alloc(upstream);
+    SlabPool *pool = self_traits::allocate(alloc, 1);
+    self_traits::construct(alloc, pool, upstream);
+    return pool;
+  }
+
+  explicit SlabPool(const ByteAllocator &upstream) : lines_(upstream) {}
+
+  SlabPool(const SlabPool &) = delete;
+  SlabPool &operator=(const SlabPool &) = delete;
+
+  ~SlabPool() {
+    while (chunks_) {
+      Chunk *chunk = chunks_;
+      chunks_ = chunk->next;
+      line_traits::deallocate(lines_, reinterpret_cast<Line *>(chunk),
+                              chunk->lines);
+    }
+  }
+
+  void Acquire() noexcept { ++refs_; }
+
+  void Release() noexcept {
+    if (--refs_ != 0) return;
+    self_allocator alloc(lines_);
+    self_traits::destroy(alloc, this);
+    self_traits::deallocate(alloc, this, 1);
+  }
+
+  // The slot size is fixed by the first type the pool serves, larger or
+  // more strictly aligned types are left to the upstream allocator.
+  bool Serves(std::size_t size, std::size_t align) noexcept {
+    if (slot_size_ == 0 && align <= kCacheLineBytes) {
+      slot_align_ = std::max(align, alignof(FreeSlot));
+      slot_size_ = RoundUp(std::max(size, sizeof(FreeSlot)), slot_align_);
+    }
+    return size <= slot_size_ && align <= slot_align_;
+  }
+
+  void *Allocate() {
+    if (!free_) Grow(SlotsFor(next_chunk_bytes_));
+    FreeSlot *slot = free_;
+    free_ = slot->next;
+    --free_count_;
+    return slot;
+  }
+
+  void Deallocate(void *slot) noexcept {
+    free_ = ::new (slot) FreeSlot{free_};
+    ++free_count_;
+  }
+
+  // Makes sure count slots can be handed out without allocating.
+  void Reserve(std::size_t count) {
+    if (count > free_count_) Grow(count - free_count_);
+  }
+
+ private:
+  line_allocator lines_;
+  std::size_t refs_ = 1;
+  std::size_t slot_size_ = 0;
+  std::size_t slot_align_ = 0;
+  std::size_t next_chunk_bytes_ = kFirstChunkBytes;
+  std::size_t free_count_ = 0;
+  FreeSlot *free_ = nullptr;
+  Chunk *chunks_ = nullptr;
+
+  static constexpr std::size_t RoundUp(std::size_t bytes,
+                                       std::size_t align) noexcept {
+    return (bytes + align - 1) / align * align;
+  }
+
+  std::size_t SlotsOffset() const noexcept {
+    return RoundUp(sizeof(Chunk), slot_align_);
+  }
+
+  std::size_t SlotsFor(std::size_t chunk_bytes) const noexcept {
+    return std::max<std::size_t>(
+        (chunk_bytes - std::min(chunk_bytes, SlotsOffset())) / slot_size_, 1);
+  }
+
+  void Grow(std::size_t slots) {
+    std::size_t bytes = SlotsOffset() + slots * slot_size_;
+    std::size_t lines = RoundUp(bytes, kCacheLineBytes) / kCacheLineBytes;
+    Line *memory = line_traits::allocate(lines_, lines);
+    chunks_ = ::new (static_cast<void *>(memory)) Chunk{chunks_, lines};
+    next_chunk_bytes_ = std::min(next_chunk_bytes_ * 2, kMaxChunkBytes);
+
+    // Whatever the rounding left over is used too. Slots are pushed in
+    // reverse so that they are handed out in address order.
+    slots = (lines * kCacheLineBytes - SlotsOffset()) / slot_size_;
+    unsigned char *first = reinterpret_cast<unsigned char *>(memory) +
+                           SlotsOffset();
+    for (std::size_t i = slots; i-- > 0;) Deallocate(first + i * slot_size_);
+  }
+};
+
+}  // namespace detail
+
+// Allocator for node-based containers such as s21::list: single objects
+// come from a slab pool, see detail::SlabPool, anything else from Upstream.
+// Copies, including rebound ones, share one pool and compare equal, so
+// lists built from copies of the same allocator can splice and merge their
+// nodes freely. A default-constructed allocator starts a pool of its own,
+// whose chunks are only allocated by the first allocate() or reserve().
+//
+// The pool isn't thread safe: containers sharing one must be used from a
+// single thread at a time.
+template <typename T, typename Upstream = std::allocator<T>>
+class pool_allocator {
+  template <typename, typename>
+  friend class pool_allocator;
+
+  using byte_allocator = typename std::allocator_traits<
+      Upstream>::template rebind_alloc<unsigned char>;
+  using pool_type = detail::SlabPool<byte_allocator>;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = pool_allocator<
+        U, typename std::allocator_traits<Upstream>::template rebind_alloc<U>>;
+  };
+
+  pool_allocator() : pool_allocator(Upstream()) {}
+
+  explicit pool_allocator(const Upstream &upstream)
+      : upstream_(upstream), pool_(pool_type::Create(upstream_)) {}
+
+  pool_allocator(const pool_allocator &other) noexcept
+      : upstream_(other.upstream_), pool_(other.pool_) {
+    pool_->Acquire();
+  }
+
+  template <typename U, typename V>
+  pool_allocator(const pool_allocator<U, V> &other) noexcept
+      : upstream_(other.upstream_), pool_(other.pool_) {
+    pool_->Acquire();
+  }
+
+  pool_allocator &operator=(const pool_allocator &other) noexcept {
+    other.pool_->Acquire();
+    pool_->Release();
+    upstream_ = other.upstream_;
+    pool_ = other.pool_;
+    return *this;
+  }
+
+  ~pool_allocator() { pool_->Release(); }
+
+  T *allocate(size_type count) {
+    if (count == 1 && pool_->Serves(sizeof(T), alignof(T)))
+      return static_cast<T *>(pool_->Allocate());
+    typed_allocator upstream(upstream_);
+    return typed_traits::allocate(upstream, count);
+  }
+
+  void deallocate(T *ptr, size_type count) noexcept {
+    if (count == 1 && pool_->Serves(sizeof(T), alignof(T))) {
+      pool_->Deallocate(ptr);
+      return;
+    }
+    typed_allocator upstream(upstream_);
+    typed_traits::deallocate(upstream, ptr, count);
+  }
+
+  // Pre-allocates room for count more single objects in the pool.
+  void reserve(size_type count) {
+    if (pool_->Serves(sizeof(T), alignof(T))) pool_->Reserve(count);
+  }
+
+  template <typename U, typename V>
+  bool operator==(const pool_allocator<U, V> &other) const noexcept {
+    return pool_ == other.pool_;
+  }
+
+  template <typename U, typename V>
+  bool operator!=(const pool_allocator<U, V> &other) const noexcept {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  using typed_allocator = typename std::allocator_traits<
+      byte_allocator>::template rebind_alloc<T>;
+  using typed_traits = std::allocator_traits<typed_allocator>;
+
+  byte_allocator upstream_;
+  pool_type *pool_;
+};
+
+namespace detail {
+
+// Whether Alloc can set aside room for more objects via reserve(count).
+template <typename Alloc, typename = void>
+inline constexpr bool kHasReserve = false;
+
+template <typename Alloc>
+inline constexpr bool kHasReserve<
+    Alloc, std::void_t<decltype(std::declval<Alloc &>().reserve(
+               std::size_t()))>> = true;
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_LIST_POOL_ALLOCATOR_H_
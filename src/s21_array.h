@@ -5,9 +5,25 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "common/algorithm.h"
+#include "common/aligned.h"
+#include "common/check_policy.h"
+#include "common/simd.h"
+
 namespace s21 {
-template <typename T, size_t N>
+// An aggregate like std::array: brace-initialized, trivially copyable whenever
+// T is, and exactly as large as its elements. Elements that get no initializer
+// are value-initialized.
+//
+// Align raises the alignment of the first element, e.g. to 32 or 64 bytes for
+// aligned SIMD loads. It can't be weaker than alignof(T).
+template <typename T, size_t N, typename CheckPolicy = check::throwing,
+          size_t Align = alignof(T)>
 class array {
+  static_assert(detail::kIsValidAlignment<Align> && Align >= alignof(T),
+                "s21::array Alignment must be a power of two no weaker than "
+                "alignof(T)");
+
  public:
   using value_type = T;
   using reference = T &;
@@ -15,69 +31,114 @@ class array {
   using iterator = T *;
   using const_iterator = const T *;
   using size_type = size_t;
+  using checked_reference = typename CheckPolicy::template result<reference>;
+  using checked_const_reference =
+      typename CheckPolicy::template result<const_reference>;
 
  public:
-  // Support for zero-sized arrays mandatory.
-
-  array() {
-    for (size_type i = 0; i < size_; ++i) {
-      array_[i] = value_type{};
-    }
-  }
-  array(std::initializer_list<value_type> const &items) {
-    size_type i = 0;
-    for (auto it = items.begin(); it != items.end(); ++it, ++i) {
-      array_[i] = *it;
-    }
-    for (; i < size_; ++i) {
-      array_[i] = value_type{};
-    }
-  }
-  array(const array &a) { std::copy(a.cbegin(), a.cend(), array_); }
-  array(array &&a) : size_(a.size_) { std::move(a.begin(), a.end(), array_); }
-  ~array() {}
-
-  array &operator=(const array &a) {
-    if (this != &a) std::copy(a.cbegin(), a.cend(), array_);
-    return *this;
+  constexpr checked_reference at(size_type pos) {
+    if (!CheckPolicy::Check(pos < N))
+      return CheckPolicy::template Fail<reference>(access_error::out_of_range,
+                                                   "array::at out of range");
+    return CheckPolicy::template Ok<reference>(array_[pos]);
   }
-  array &operator=(array &&a) {
-    if (this != &a) std::move(a.begin(), a.end(), array_);
-    return *this;
+  constexpr checked_const_reference at(size_type pos) const {
+    if (!CheckPolicy::Check(pos < N))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::out_of_range, "array::at out of range");
+    return CheckPolicy::template Ok<const_reference>(array_[pos]);
   }
-  reference at(size_type pos) {
-    if (pos >= size_) throw std::out_of_range("array::at out of range");
+  constexpr reference operator[](size_type pos) noexcept {
     return array_[pos];
   }
-  const_reference at(size_type pos) const {
-    if (pos >= size_) throw std::out_of_range("array::at out of range");
+  constexpr const_reference operator[](size_type pos) const noexcept {
     return array_[pos];
   }
-  reference operator[](size_type pos) noexcept { return array_[pos]; }
-  const_reference operator[](size_type pos) const noexcept {
-    return array_[pos];
+  constexpr checked_reference front() {
+    if (!CheckPolicy::Check(N != 0))
+      return CheckPolicy::template Fail<reference>(access_error::empty,
+                                                   "array::front empty array");
+    return CheckPolicy::template Ok<reference>(array_[0]);
   }
-  const_reference front() const { return array_[0]; }
-  const_reference back() const { return array_[size_ - 1]; }
-  iterator data() noexcept { return array_; }
-  const_iterator data() const noexcept { return array_; }
+  constexpr checked_const_reference front() const {
+    if (!CheckPolicy::Check(N != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "array::front empty array");
+    return CheckPolicy::template Ok<const_reference>(array_[0]);
+  }
+  constexpr checked_reference back() {
+    if (!CheckPolicy::Check(N != 0))
+      return CheckPolicy::template Fail<reference>(access_error::empty,
+                                                   "array::back empty array");
+    return CheckPolicy::template Ok<reference>(array_[N - 1]);
+  }
+  constexpr checked_const_reference back() const {
+    if (!CheckPolicy::Check(N != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "array::back empty array");
+    return CheckPolicy::template Ok<const_reference>(array_[N - 1]);
+  }
+  constexpr iterator data() noexcept { return array_; }
+  constexpr const_iterator data() const noexcept { return array_; }
 
-  iterator begin() noexcept { return array_; }
-  iterator end() noexcept { return &array_[size_]; }
-  const_iterator cbegin() const noexcept { return array_; }
-  const_iterator cend() const noexcept { return &array_[size_]; }
+  constexpr iterator begin() noexcept { return array_; }
+  constexpr iterator end() noexcept { return array_ + N; }
+  constexpr const_iterator begin() const noexcept { return array_; }
+  constexpr const_iterator end() const noexcept { return array_ + N; }
+  constexpr const_iterator cbegin() const noexcept { return array_; }
+  constexpr const_iterator cend() const noexcept { return array_ + N; }
 
-  bool empty() const noexcept { return size_ == 0; }
-  size_type size() const noexcept { return size_; }
-  size_type max_size() const noexcept { return size_; }
+  // Arithmetic elements are scanned with SIMD where the CPU supports it.
+  iterator find(const_reference value) noexcept {
+    return begin() + detail::simd::Find(array_, N, value);
+  }
+  const_iterator find(const_reference value) const noexcept {
+    return cbegin() + detail::simd::Find(array_, N, value);
+  }
+  size_type count(const_reference value) const noexcept {
+    return detail::simd::Count(array_, N, value);
+  }
+  bool contains(const_reference value) const noexcept {
+    return find(value) != cend();
+  }
+  checked_const_reference min() const {
+    if (!CheckPolicy::Check(N != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "array::min empty array");
+    return CheckPolicy::template Ok<const_reference>(
+        array_[detail::simd::MinIndex(array_, N)]);
+  }
+  checked_const_reference max() const {
+    if (!CheckPolicy::Check(N != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "array::max empty array");
+    return CheckPolicy::template Ok<const_reference>(
+        array_[detail::simd::MaxIndex(array_, N)]);
+  }
+  detail::simd::SumType<value_type> sum() const noexcept {
+    return detail::simd::Sum(array_, N);
+  }
 
-  void swap(array &other) noexcept { std::swap(*this, other); }
-  void fill(const_reference value) { std::fill(begin(), end(), value); }
+  constexpr bool empty() const noexcept { return N == 0; }
+  constexpr size_type size() const noexcept { return N; }
+  constexpr size_type max_size() const noexcept { return N; }
 
- private:
-  const size_type size_ = N;
-  value_type array_[N ? N : 1];
+  constexpr void swap(array &other) noexcept(
+      noexcept(constexpr_algo::swap_values(other.array_[0],
+                                           other.array_[0]))) {
+    for (size_type i = 0; i < N; ++i)
+      constexpr_algo::swap_values(array_[i], other.array_[i]);
+  }
+  constexpr void fill(const_reference value) {
+    constexpr_algo::fill(begin(), end(), value);
+  }
+
+  // Public only so that array stays an aggregate, not part of the API.
+  alignas(Align) value_type array_[N ? N : 1] = {};
 };
+
+template <typename T, size_t N, size_t Align = kCacheLineBytes>
+using aligned_array = array<T, N, check::throwing, Align>;
 }  // namespace s21
 
 #endif  // CPP2_S21_CONTAINERS_S21_ARRAY_H_
\ No newline at end of file
@@ -0,0 +1,304 @@
+#ifndef CPP2_S21_CONTAINERS_S21_CONCURRENT_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_CONCURRENT_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "common/index_iterator.h"
+
+namespace s21 {
+
+// Append-only vector that many threads may grow at once without a lock.
+// push_back() and grow_by() claim their slots with a compare-and-swap on the
+// size, after making sure the segments behind them exist, so a thread only
+// retries when another one has just claimed slots, and a failed allocation
+// leaves nothing half claimed. A new segment is published with one more
+// compare-and-swap, the losers of that race free their copy.
+//
+// The elements live in segments of 8, 16, 32, ... slots that are never
+// moved or freed before clear(), so references and iterators stay valid
+// while other threads keep appending.
+//
+// size() counts claimed slots, some of which other threads may still be
+// constructing. An element may be read once the append that made it has
+// returned in a thread that happens-before the reader, e.g. after joining
+// the producers. clear(), swap and destruction are not thread safe.
+//
+// Claimed slots can't be given back, so when an append throws its slots are
+// marked broken instead: they stay counted in size() but hold no object, see
+// is_broken(). A failed grow_by() breaks its whole run.
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_vector {
+  static constexpr std::size_t kFirstBits = 3;
+  static constexpr std::size_t kFirstSegment = std::size_t(1) << kFirstBits;
+  static constexpr std::size_t kMaxSegments = 64 - kFirstBits;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = detail::IndexIterator<concurrent_vector, reference>;
+  using const_iterator =
+      detail::IndexIterator<const concurrent_vector, const_reference>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  // Member functions
+ public:
+  concurrent_vector() {}
+
+  explicit concurrent_vector(const allocator_type &alloc)
+      : allocator_(alloc) {}
+
+  concurrent_vector(const concurrent_vector &) = delete;
+  concurrent_vector &operator=(const concurrent_vector &) = delete;
+
+  ~concurrent_vector() {
+    clear();
+    word_allocator words(allocator_);
+    for (size_type s = 0; s < kMaxSegments; ++s) {
+      T *segment = segments_[s].load(std::memory_order_relaxed);
+      if (segment) alloc_traits::deallocate(allocator_, segment, SlotsIn(s));
+      BrokenWord *broken = broken_[s].load(std::memory_order_relaxed);
+      if (broken) word_traits::deallocate(words, broken, WordsIn(s));
+    }
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_; }
+
+  // Element Access
+ public:
+  reference at(size_type pos) {
+    if (pos >= size())
+      throw std::out_of_range(
+          "s21::concurrent_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size())
+      throw std::out_of_range(
+          "s21::concurrent_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  // Never checked, use at() for checked access.
+  reference operator[](size_type pos) noexcept { return *Slot(pos); }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return *Slot(pos);
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+  iterator end() noexcept { return iterator(this, size()); }
+
+  const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+  // Whether the append that claimed pos threw. Such a slot holds no object
+  // and must not be accessed.
+  bool is_broken(size_type pos) const noexcept {
+    size_type segment = SegmentOf(pos);
+    size_type bit = pos - SegmentStart(segment);
+    const BrokenWord *broken = broken_[segment].load(std::memory_order_acquire);
+    return (broken[bit / kWordBits].load(std::memory_order_relaxed) >>
+            bit % kWordBits) & 1;
+  }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+
+  size_type max_size() const noexcept {
+    return std::min<size_type>(alloc_traits::max_size(allocator_),
+                               SegmentStart(kMaxSegments - 1));
+  }
+
+  // Allocates the segments for the first new_cap slots up front.
+  void reserve(size_type new_cap) {
+    CheckSize(new_cap);
+    if (new_cap) EnsureSegments(0, new_cap);
+  }
+
+  // Modifiers
+ public:
+  // Thread safe with each other: push_back, emplace_back and grow_by.
+  iterator push_back(const_reference value) {
+    size_type pos = Claim(1);
+    Construct(pos, value);
+    return iterator(this, pos);
+  }
+
+  iterator push_back(value_type &&value) {
+    size_type pos = Claim(1);
+    Construct(pos, std::move(value));
+    return iterator(this, pos);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    size_type pos = Claim(1);
+    Construct(pos, std::forward<Args>(args)...);
+    return (*this)[pos];
+  }
+
+  // Appends count value-initialized elements as one contiguous run of
+  // indices, returns an iterator to the first of them.
+  iterator grow_by(size_type count) {
+    size_type first = Claim(count);
+    ConstructRun(first, count);
+    return iterator(this, first);
+  }
+
+  iterator grow_by(size_type count, const_reference value) {
+    size_type first = Claim(count);
+    ConstructRun(first, count, value);
+    return iterator(this, first);
+  }
+
+  // Not thread safe. The segments are kept for reuse.
+  void clear() noexcept {
+    size_type size = size_.exchange(0, std::memory_order_relaxed);
+    for (size_type pos = 0; pos < size; ++pos)
+      if (!is_broken(pos)) alloc_traits::destroy(allocator_, Slot(pos));
+    for (size_type s = 0; s < kMaxSegments && SegmentStart(s) < size; ++s)
+      for (size_type w = 0; w < WordsIn(s); ++w)
+        broken_[s].load(std::memory_order_relaxed)[w].store(
+            0, std::memory_order_relaxed);
+  }
+
+ private:
+  // One bit per slot of a segment, set for broken slots.
+  using BrokenWord = std::atomic<std::uint64_t>;
+  using word_allocator =
+      typename alloc_traits::template rebind_alloc<BrokenWord>;
+  using word_traits = std::allocator_traits<word_allocator>;
+  static constexpr size_type kWordBits = 64;
+
+  allocator_type allocator_;
+  std::atomic<size_type> size_{0};
+  std::atomic<T *> segments_[kMaxSegments] = {};
+  std::atomic<BrokenWord *> broken_[kMaxSegments] = {};
+
+  static constexpr size_type SlotsIn(size_type segment) noexcept {
+    return kFirstSegment << segment;
+  }
+
+  static constexpr size_type WordsIn(size_type segment) noexcept {
+    return (SlotsIn(segment) + kWordBits - 1) / kWordBits;
+  }
+
+  // Index of the first slot of a segment.
+  static constexpr size_type SegmentStart(size_type segment) noexcept {
+    return (kFirstSegment << segment) - kFirstSegment;
+  }
+
+  static size_type SegmentOf(size_type pos) noexcept {
+    size_type chunks = (pos >> kFirstBits) + 1;
+    return 63 - __builtin_clzll(chunks);
+  }
+
+  T *Slot(size_type pos) const noexcept {
+    size_type segment = SegmentOf(pos);
+    return segments_[segment].load(std::memory_order_acquire) + pos -
+           SegmentStart(segment);
+  }
+
+  void CheckSize(size_type size) const {
+    if (size > max_size())
+      throw std::length_error(
+          "s21::concurrent_vector Size can't be larger than max_size()");
+  }
+
+  // Reserves count slots for the calling thread, returns the first index.
+  size_type Claim(size_type count) {
+    size_type first = size_.load(std::memory_order_relaxed);
+    do {
+      if (count > max_size() - first)
+        throw std::length_error(
+            "s21::concurrent_vector Size can't be larger than max_size()");
+      if (count) EnsureSegments(first, first + count);
+    } while (!size_.compare_exchange_weak(first, first + count,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed));
+    return first;
+  }
+
+  // The broken bits of a segment are published before the segment itself,
+  // so they exist for every slot that can be claimed.
+  void EnsureSegments(size_type first, size_type last) {
+    for (size_type s = SegmentOf(first); s <= SegmentOf(last - 1); ++s) {
+      if (segments_[s].load(std::memory_order_acquire)) continue;
+      if (!broken_[s].load(std::memory_order_acquire)) {
+        word_allocator words(allocator_);
+        BrokenWord *broken = word_traits::allocate(words, WordsIn(s));
+        for (size_type w = 0; w < WordsIn(s); ++w)
+          ::new (static_cast<void *>(broken + w)) BrokenWord(0);
+        BrokenWord *expected = nullptr;
+        if (!broken_[s].compare_exchange_strong(expected, broken,
+                                                std::memory_order_acq_rel))
+          word_traits::deallocate(words, broken, WordsIn(s));
+      }
+      T *segment = alloc_traits::allocate(allocator_, SlotsIn(s));
+      T *expected = nullptr;
+      if (!segments_[s].compare_exchange_strong(expected, segment,
+                                                std::memory_order_acq_rel))
+        alloc_traits::deallocate(allocator_, segment, SlotsIn(s));
+    }
+  }
+
+  void MarkBroken(size_type pos) noexcept {
+    size_type segment = SegmentOf(pos);
+    size_type bit = pos - SegmentStart(segment);
+    broken_[segment].load(std::memory_order_acquire)[bit / kWordBits].fetch_or(
+        std::uint64_t(1) << bit % kWordBits, std::memory_order_release);
+  }
+
+  template <typename... Args>
+  void Construct(size_type pos, Args &&...args) {
+    try {
+      alloc_traits::construct(allocator_, Slot(pos),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      MarkBroken(pos);
+      throw;
+    }
+  }
+
+  // Builds count elements from first on. If one throws, those already built
+  // are destroyed again and the whole run is marked broken.
+  template <typename... Args>
+  void ConstructRun(size_type first, size_type count, const Args &...args) {
+    size_type pos = first;
+    try {
+      for (; pos < first + count; ++pos)
+        alloc_traits::construct(allocator_, Slot(pos), args...);
+    } catch (...) {
+      for (size_type built = first; built < pos; ++built)
+        alloc_traits::destroy(allocator_, Slot(built));
+      for (pos = first; pos < first + count; ++pos) MarkBroken(pos);
+      throw;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_CONCURRENT_VECTOR_H_
@@ -1,6 +1,14 @@
 #ifndef CPP2_S21_CONTAINERS_S21_CONTAINERSPLUS_H_
 #define CPP2_S21_CONTAINERS_S21_CONTAINERSPLUS_H_
 #include "s21_array.h"
+#include "s21_concurrent_vector.h"
+#include "s21_mapped_vector.h"
 #include "s21_multiset.h"
+#include "s21_persistent_vector.h"
+#include "s21_small_vector.h"
+#include "s21_soa_vector.h"
+#include "s21_static_vector.h"
+#include "s21_unrolled_list.h"
+#include "s21_varlen_vector.h"
 
 #endif  // CPP2_S21_CONTAINERS_S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -1,8 +1,16 @@
 #ifndef CPP2_S21_CONTAINERS_S21_LIST_H_
 #define CPP2_S21_CONTAINERS_S21_LIST_H_
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "common/check_policy.h"
+#include "list/pool_allocator.h"
 
 namespace s21 {
 template <typename T>
@@ -11,34 +19,64 @@ class ListIterator;
 template <typename T>
 class ListConstIterator;
 
+// The links of a node. A list embeds a bare one as its end sentinel, so
+// the sentinel holds no value and costs no allocation.
+struct ListNodeBase {
+  ListNodeBase* next_ = nullptr;
+  ListNodeBase* prev_ = nullptr;
+};
+
 template <typename T>
+struct ListNode : ListNodeBase {
+  T data_;
+
+  template <typename... Args>
+  explicit ListNode(Args&&... args) : data_(std::forward<Args>(args)...) {}
+};
+
+// The nodes form a ring through the end sentinel embedded in the list:
+// end_.next_ is the first node and end_.prev_ the last one, an empty list
+// links the sentinel to itself. Nodes are allocated one at a time through
+// Allocator; s21::pool_allocator serves them from a slab pool instead of
+// the heap. CheckPolicy decides how front() and back() treat an empty list,
+// see common/check_policy.h.
+template <typename T, typename Allocator = std::allocator<T>,
+          typename CheckPolicy = check::throwing>
 class list {
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T&;
   using const_reference = const T&;
   using iterator = ListIterator<T>;
   using const_iterator = ListConstIterator<T>;
   using size_type = size_t;
+  using checked_reference = typename CheckPolicy::template result<reference>;
+  using checked_const_reference =
+      typename CheckPolicy::template result<const_reference>;
+
+  list() : list(allocator_type()) {}
 
-  list() : size_(0) { head_ = tail_ = end_ = new Node(value_type()); }
+  explicit list(const allocator_type& alloc) noexcept
+      : node_alloc_(alloc), size_(0) {
+    end_.next_ = end_.prev_ = &end_;
+  }
 
-  list(size_type n) {
-    size_ = 0;
-    head_ = tail_ = end_ = new Node(value_type());
-    for (size_type i = 0; i < n; ++i) push_back(value_type());
+  list(size_type n) : list() {
+    for (size_type i = 0; i < n; ++i) emplace_back();
   }
 
-  list(std::initializer_list<value_type> const& items) : size_(0) {
-    head_ = tail_ = end_ = new Node(value_type());
+  list(std::initializer_list<value_type> const& items) : list() {
     for (auto it = items.begin(); it != items.end(); ++it) {
       push_back(*it);
     }
   }
 
-  ~list() { RemoveList(); }
+  ~list() { clear(); }
 
-  list(const list& l) : list() {
+  list(const list& l)
+      : list(node_traits::select_on_container_copy_construction(
+            l.node_alloc_)) {
     for (auto it = l.begin(); it != l.end(); ++it) {
       push_back(*it);
     }
@@ -46,13 +84,13 @@ class list {
 
   list& operator=(const list& l) {
     list copy(l);
-    swap(this, copy);
+    swap(copy);
     return *this;
   }
 
-  list(list&& l) : list() { swap(l); }
+  list(list&& l) noexcept : list(l.get_allocator()) { swap(l); }
 
-  list& operator=(list&& l) {
+  list& operator=(list&& l) noexcept {
     if (this != &l) {
       clear();
       swap(l);
@@ -60,24 +98,51 @@ class list {
     return *this;
   }
 
-  void swap(list& other) {
-    std::swap(head_, other.head_);
-    std::swap(tail_, other.tail_);
+  void swap(list& other) noexcept {
+    std::swap(node_alloc_, other.node_alloc_);
     std::swap(end_, other.end_);
     std::swap(size_, other.size_);
+    AttachSentinel();
+    other.AttachSentinel();
+  }
+
+  allocator_type get_allocator() const { return allocator_type(node_alloc_); }
+
+  checked_reference front() {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<reference>(
+          access_error::empty, "list::front() called with empty list");
+    return CheckPolicy::template Ok<reference>(Value(end_.next_));
   }
 
-  const_reference front() const { return head_->data_; }
+  checked_const_reference front() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "list::front() called with empty list");
+    return CheckPolicy::template Ok<const_reference>(Value(end_.next_));
+  }
 
-  const_reference back() const { return tail_->data_; }
+  checked_reference back() {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<reference>(
+          access_error::empty, "list::back() called with empty list");
+    return CheckPolicy::template Ok<reference>(Value(end_.prev_));
+  }
 
-  iterator begin() { return iterator(head_); }
+  checked_const_reference back() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "list::back() called with empty list");
+    return CheckPolicy::template Ok<const_reference>(Value(end_.prev_));
+  }
 
-  iterator end() { return iterator(end_); }
+  iterator begin() { return iterator(end_.next_); }
 
-  iterator begin() const { return iterator(head_); }
+  iterator end() { return iterator(&end_); }
 
-  iterator end() const { return iterator(end_); }
+  iterator begin() const { return iterator(end_.next_); }
+
+  iterator end() const { return iterator(const_cast<NodeBase*>(&end_)); }
 
   bool empty() const { return size_ == 0; }
 
@@ -87,145 +152,131 @@ class list {
     return (std::numeric_limits<size_type>::max() / sizeof(Node) / 2);
   }
 
-  void clear() {
+  // Lets the allocator set aside nodes for n elements in total, so that
+  // growing to n allocates nothing more. Only allocators with a reserve(),
+  // such as s21::pool_allocator, can do that, for others it does nothing.
+  void reserve(size_type n) {
+    if constexpr (detail::kHasReserve<node_allocator>)
+      if (n > size_) node_alloc_.reserve(n - size_);
+  }
+
+  void clear() noexcept {
     while (!empty()) {
-      pop_back();
+      Remove(end_.prev_);
     }
   }
 
   iterator insert(iterator pos, const_reference value) {
-    Node* new_node = new Node(value);
-
-    new_node->next_ = pos.ptr;
-    new_node->prev_ = pos.ptr->prev_;
-    if (pos == begin())
-      head_ = new_node;
-    else
-      pos.ptr->prev_->next_ = new_node;
+    return emplace(pos, value);
+  }
 
-    pos.ptr->prev_ = new_node;
+  iterator insert(iterator pos, value_type&& value) {
+    return emplace(pos, std::move(value));
+  }
 
-    if (pos == end()) tail_ = new_node;
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args) {
+    Node* new_node = CreateNode(std::forward<Args>(args)...);
+    LinkBefore(pos.ptr, new_node, new_node);
     ++size_;
     return iterator(new_node);
   }
 
   void erase(iterator pos) {
-    if (!empty() && pos != end_) {
-      if (pos == begin())
-        head_ = pos.ptr->next_;
-      else
-        pos.ptr->prev_->next_ = pos.ptr->next_;
-      if (pos == iterator(tail_)) tail_ = pos.ptr->prev_;
-      pos.ptr->next_->prev_ = pos.ptr->prev_;
-      delete pos.ptr;
-      --size_;
-    }
+    if (pos.ptr != &end_) Remove(pos.ptr);
   }
 
   void pop_back() {
     if (empty())
       throw std::out_of_range("list::pop_back() called with empty list");
-    Node* last_node = tail_;
-    if (size_ == 1) {
-      end_->prev_ = nullptr;
-      head_ = tail_ = end_;
-    } else if (size_ == 2) {
-      tail_ = head_;
-      head_->next_ = end_;
-      end_->prev_ = head_;
-    } else {
-      tail_ = tail_->prev_;
-      tail_->next_ = end_;
-      end_->prev_ = tail_;
-    }
-    delete last_node;
-    --size_;
+    Remove(end_.prev_);
   }
 
-  void push_back(const_reference value) {
-    Node* tmp_node = new Node(value);
+  void push_back(const_reference value) { emplace_back(value); }
 
-    if (size_ == 0) {
-      head_ = tail_ = tmp_node;
-    } else if (size_ == 1) {
-      tail_ = tmp_node;
-      head_->next_ = tail_;
-      tail_->prev_ = head_;
-    } else {
-      tail_->next_ = tmp_node;
-      tmp_node->prev_ = tail_;
-      tail_ = tmp_node;
-    }
-    end_->prev_ = tail_;
-    tail_->next_ = end_;
-    ++size_;
-    end_->data_ = size_;
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
   }
 
-  void push_front(const_reference value) {
-    Node* tmp_node = new Node(value);
-    if (size_ == 0) {
-      head_ = tail_ = tmp_node;
-      end_->prev_ = tail_;
-      tail_->next_ = end_;
-    } else if (size_ == 1) {
-      head_ = tmp_node;
-      head_->next_ = tail_;
-      tail_->prev_ = head_;
-    } else {
-      head_->prev_ = tmp_node;
-      tmp_node->next_ = head_;
-      head_ = tmp_node;
-    }
-    ++size_;
-    end_->data_ = size_;
+  void push_front(const_reference value) { emplace_front(value); }
+
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
   }
 
   void pop_front() {
     if (empty())
       throw std::out_of_range("list::pop_front() called with empty list");
-    Node* first_node = head_;
-    if (size_ == 1) {
-      end_->prev_ = nullptr;
-      head_ = tail_ = end_;
-    } else if (size_ == 2) {
-      head_ = tail_;
-      head_->prev_ = nullptr;
-    } else {
-      head_ = head_->next_;
-      head_->prev_ = nullptr;
-    }
-    delete first_node;
-    --size_;
+    Remove(end_.next_);
   }
 
-  void merge(list& other) {
-    iterator this_it = begin();
-    iterator other_it = other.begin();
-    while (other_it != other.end()) {
-      if (*this_it <= *other_it && this_it != end()) {
-        ++this_it;
-      } else if (*this_it > *other_it || this_it == end()) {
-        insert(this_it, *other_it);
-        ++other_it;
+  // Merges the sorted other into this sorted list in O(n + m) by relinking
+  // its nodes, other ends up empty. Stable: on ties elements of this list
+  // come first.
+  void merge(list& other) { merge(other, std::less<>()); }
+
+  template <typename Compare>
+  void merge(list& other, Compare comp) {
+    if (&other == this) return;
+
+    NodeBase* pos = end_.next_;
+    while (!other.empty()) {
+      NodeBase* first = other.end_.next_;
+      while (pos != &end_ && !comp(Value(first), Value(pos))) pos = pos->next_;
+
+      // Every element of other that goes before pos moves as one run.
+      NodeBase* last = other.end_.prev_;
+      size_type count = other.size_;
+      if (pos != &end_) {
+        last = first;
+        count = 1;
+        while (last->next_ != &other.end_ &&
+               comp(Value(last->next_), Value(pos))) {
+          last = last->next_;
+          ++count;
+        }
       }
+      Transfer(pos, other, first, last, count);
     }
   }
 
+  // The splices move nodes without copying or allocating: the whole list
+  // and a single element in O(1), a range of another list in O(k) to count
+  // it. Iterators to the moved elements stay valid and now point into this
+  // list.
   void splice(const_iterator pos, list& other) {
-    for (iterator it = other.begin(); it != other.end(); ++it) {
-      insert(pos, *it);
-    }
-    other.clear();
+    if (&other == this || other.empty()) return;
+    Transfer(pos.ptr, other, other.end_.next_, other.end_.prev_, other.size_);
+  }
+
+  void splice(const_iterator pos, list& other, const_iterator it) {
+    if (it.ptr == pos.ptr || it.ptr->next_ == pos.ptr) return;
+    Transfer(pos.ptr, other, it.ptr, it.ptr, 1);
+  }
+
+  // pos must not be in [first, last).
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last) {
+    if (first == last) return;
+    size_type count = 0;
+    if (&other != this)
+      for (NodeBase* node = first.ptr; node != last.ptr; node = node->next_)
+        ++count;
+    Transfer(pos.ptr, other, first.ptr, last.ptr->prev_, count);
   }
 
   void reverse() {
-    Node* head_node = head_;
-    Node* tail_node = tail_;
+    NodeBase* head_node = end_.next_;
+    NodeBase* tail_node = end_.prev_;
     size_type half = size_ / 2;
     for (size_type step = 0; step < half; ++step) {
-      std::swap(head_node->data_, tail_node->data_);
+      std::swap(Value(head_node), Value(tail_node));
       head_node = head_node->next_;
       tail_node = tail_node->prev_;
     }
@@ -233,44 +284,164 @@ class list {
 
   void unique() {
     for (auto it = ++(begin()); it != end() && !empty(); ++it) {
-      if (it.ptr->data_ == it.ptr->prev_->data_) {
+      if (Value(it.ptr) == Value(it.ptr->prev_)) {
         iterator on_delete = iterator(it.ptr->prev_);
         erase(on_delete);
       }
     }
   }
 
-  void sort() { sorting(); }
-
-  void sorting() {
-    for (auto current = ++begin(); current != end() && !empty(); ++current) {
-      if (current.ptr->data_ < current.ptr->prev_->data_) {
-        std::swap(current.ptr->data_, current.ptr->prev_->data_);
-        sorting();
+  // Stable O(n log n) merge sort that relinks the nodes, elements are never
+  // copied or moved and nothing is allocated.
+  void sort() { sort(std::less<>()); }
+
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+
+    // Bottom-up: runs[i] is a sorted run of 2^i nodes, or empty. Each node
+    // is carried up like a binary counter increment, merging equal-sized
+    // runs. Runs are singly linked through next_ until the end.
+    NodeBase* runs[std::numeric_limits<size_type>::digits] = {};
+    size_type top = 0;
+    for (NodeBase* node = end_.next_; node != &end_;) {
+      NodeBase* carry = node;
+      node = node->next_;
+      carry->next_ = nullptr;
+      size_type i = 0;
+      for (; runs[i]; ++i) {
+        carry = MergeRuns(runs[i], carry, comp);
+        runs[i] = nullptr;
       }
+      runs[i] = carry;
+      top = std::max(top, i);
     }
+
+    // Higher runs hold earlier elements, they go first to keep it stable.
+    NodeBase* sorted = nullptr;
+    for (size_type i = 0; i <= top; ++i)
+      if (runs[i]) sorted = sorted ? MergeRuns(runs[i], sorted, comp) : runs[i];
+    RelinkSorted(sorted);
   }
 
  private:
-  struct Node {
-    Node* next_;
-    Node* prev_;
-    value_type data_;
+  using NodeBase = ListNodeBase;
+  using Node = ListNode<T>;
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  node_allocator node_alloc_;
+  NodeBase end_;
+  size_type size_;
 
-    Node(value_type value) : next_(nullptr), prev_(nullptr), data_(value) {}
-  };
+  // Only ever called on nodes other than the sentinel.
+  static reference Value(NodeBase* node) noexcept {
+    return static_cast<Node*>(node)->data_;
+  }
 
-  Node* head_;
-  Node* tail_;
-  Node* end_;
-  size_type size_;
+  static const_reference Value(const NodeBase* node) noexcept {
+    return static_cast<const Node*>(node)->data_;
+  }
+
+  // Points the ring back at end_ after its links were copied from another
+  // list.
+  void AttachSentinel() noexcept {
+    if (size_ == 0) {
+      end_.next_ = end_.prev_ = &end_;
+    } else {
+      end_.next_->prev_ = &end_;
+      end_.prev_->next_ = &end_;
+    }
+  }
 
-  void RemoveList() {
-    clear();
-    delete head_;
+  template <typename... Args>
+  Node* CreateNode(Args&&... args) {
+    Node* node = node_traits::allocate(node_alloc_, 1);
+    try {
+      node_traits::construct(node_alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(node_alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void DestroyNode(NodeBase* base) noexcept {
+    Node* node = static_cast<Node*>(base);
+    node_traits::destroy(node_alloc_, node);
+    node_traits::deallocate(node_alloc_, node, 1);
+  }
+
+  void Remove(NodeBase* node) noexcept {
+    Unlink(node, node);
+    DestroyNode(node);
+    --size_;
+  }
+
+  // Moves the count nodes [first, last] of other in front of pos. Nodes
+  // can only change lists if both allocators can free them, otherwise the
+  // elements are moved into new nodes.
+  void Transfer(NodeBase* pos, list& other, NodeBase* first, NodeBase* last,
+                size_type count) {
+    if constexpr (!node_traits::is_always_equal::value) {
+      if (node_alloc_ != other.node_alloc_) {
+        NodeBase* stop = last->next_;
+        for (NodeBase* next = first; next != stop;) {
+          NodeBase* node = next;
+          next = node->next_;
+          emplace(iterator(pos), std::move(Value(node)));
+          other.erase(iterator(node));
+        }
+        return;
+      }
+    }
+    other.Unlink(first, last);
+    other.size_ -= count;
+    LinkBefore(pos, first, last);
+    size_ += count;
+  }
+
+  // Thanks to the sentinel every node has both neighbours, so linking and
+  // unlinking a run never needs special cases.
+  static void Unlink(NodeBase* first, NodeBase* last) noexcept {
+    first->prev_->next_ = last->next_;
+    last->next_->prev_ = first->prev_;
+  }
+
+  static void LinkBefore(NodeBase* pos, NodeBase* first,
+                         NodeBase* last) noexcept {
+    first->prev_ = pos->prev_;
+    last->next_ = pos;
+    pos->prev_->next_ = first;
+    pos->prev_ = last;
   }
 
-  friend ListIterator<T>;
+  // Merges two null-terminated runs linked through next_. On ties the node
+  // of first wins, so first must hold the earlier elements.
+  template <typename Compare>
+  static NodeBase* MergeRuns(NodeBase* first, NodeBase* second,
+                             Compare& comp) {
+    NodeBase* merged = nullptr;
+    NodeBase** link = &merged;
+    while (first && second) {
+      NodeBase*& from = comp(Value(second), Value(first)) ? second : first;
+      *link = from;
+      link = &from->next_;
+      from = from->next_;
+    }
+    *link = first ? first : second;
+    return merged;
+  }
+
+  // Restores the prev_ links and the sentinel around a next_-linked run.
+  void RelinkSorted(NodeBase* first) {
+    end_.next_ = first;
+    first->prev_ = &end_;
+    for (; first->next_; first = first->next_) first->next_->prev_ = first;
+    first->next_ = &end_;
+    end_.prev_ = first;
+  }
 };
 
 template <typename T>
@@ -280,11 +451,12 @@ class ListIterator {
   using value_type = T;
   ListIterator() : ptr(nullptr){};
 
-  ListIterator(typename list<T>::Node* node_ptr) : ptr(node_ptr){};
+  ListIterator(ListNodeBase* node_ptr) : ptr(node_ptr){};
 
+  // end() has no value, dereferencing it is undefined.
   reference operator*() {
     if (!ptr) throw std::invalid_argument("It`s empty iterator!");
-    return ptr->data_;
+    return static_cast<ListNode<T>*>(ptr)->data_;
   }
 
   ListIterator& operator++() {
@@ -314,8 +486,9 @@ class ListIterator {
   bool operator!=(ListIterator other) { return this->ptr != other.ptr; }
 
  private:
-  typename list<T>::Node* ptr;
-  friend list<T>;
+  ListNodeBase* ptr;
+  template <typename, typename, typename>
+  friend class list;
 };
 
 template <typename T>
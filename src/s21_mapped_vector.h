@@ -0,0 +1,574 @@
+#ifndef CPP2_S21_CONTAINERS_S21_MAPPED_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_MAPPED_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "common/simd.h"
+#include "vector/growth_policy.h"
+
+namespace s21 {
+
+// Vector of trivially copyable elements that lives in a file. The file is
+// mapped into memory, so attaching to an existing one costs a few system
+// calls however much data it holds, and the elements are read straight from
+// the page cache. Growing extends the file with ftruncate and remaps it,
+// with mremap on Linux, so the elements are never copied.
+//
+// The file starts with a 64-byte header that records the element size and
+// the number of elements, followed by the elements themselves. Any spare
+// capacity stays in the file as well, shrink_to_fit() truncates it away.
+//
+// Changes reach the file through the page cache even if the process dies,
+// flush() waits until they are on disk. Growing may move the mapping, which
+// invalidates pointers, references and iterators like a reallocation of
+// s21::vector does.
+//
+// mapped_vector<const T> attaches read-only: it maps the file without write
+// access and only hands out const references, and the calls that would
+// change it don't compile.
+template <typename T, typename GrowthPolicy = growth::large_buffer<>>
+class mapped_vector {
+  static constexpr std::size_t kHeaderBytes = 64;
+  static constexpr bool kReadOnly = std::is_const_v<T>;
+
+  static_assert(std::is_trivially_copyable_v<T>,
+                "s21::mapped_vector needs a trivially copyable T");
+  static_assert(alignof(T) <= kHeaderBytes,
+                "s21::mapped_vector can't align T past the file header");
+
+  struct Header {
+    char magic[8];
+    std::uint64_t value_size;
+    std::uint64_t size;
+  };
+
+  static constexpr char kMagic[8] = {'s', '2', '1', 'm', 'v', 'e', 'c', '1'};
+
+ public:
+  using value_type = std::remove_const_t<T>;
+  using reference = T &;
+  using const_reference = const value_type &;
+  using iterator = T *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  // Member functions
+ public:
+  // A vector that is not attached to any file, it can only be moved into.
+  mapped_vector() {}
+
+  // Attaches to the file at path. A writable vector creates it if it
+  // doesn't exist yet, a read-only one throws std::system_error.
+  explicit mapped_vector(const std::string &path) { Open(path); }
+
+  mapped_vector(const mapped_vector &) = delete;
+  mapped_vector &operator=(const mapped_vector &) = delete;
+
+  mapped_vector(mapped_vector &&other) noexcept { swap(other); }
+
+  mapped_vector &operator=(mapped_vector &&other) noexcept {
+    mapped_vector(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  // Unmaps the file without waiting for it to be written back.
+  ~mapped_vector() { Close(); }
+
+  bool is_open() const noexcept { return fd_ >= 0; }
+
+  static constexpr bool read_only() noexcept { return kReadOnly; }
+
+  // Writes the changed pages back to the file and waits for the disk.
+  void flush() {
+    if (base_ && msync(base_, mapped_bytes_, MS_SYNC) != 0)
+      throw SystemError("flush");
+  }
+
+  // Element Access
+ public:
+  reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::mapped_vector::at The index is out of range");
+    return data()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::mapped_vector::at The index is out of range");
+    return data()[pos];
+  }
+
+  // Never checked, use at() for checked access.
+  reference operator[](size_type pos) noexcept { return data()[pos]; }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return data()[pos];
+  }
+
+  reference front() {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::mapped_vector::front Using methods on a zero sized container "
+          "results in the UB");
+    return data()[0];
+  }
+
+  const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::mapped_vector::front Using methods on a zero sized container "
+          "results in the UB");
+    return data()[0];
+  }
+
+  reference back() {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::mapped_vector::back Using methods on a zero sized container "
+          "results in the UB");
+    return data()[size_ - 1];
+  }
+
+  const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::mapped_vector::back Using methods on a zero sized container "
+          "results in the UB");
+    return data()[size_ - 1];
+  }
+
+  iterator data() noexcept {
+    return base_ ? reinterpret_cast<T *>(base_ + kHeaderBytes) : nullptr;
+  }
+
+  const_iterator data() const noexcept {
+    return base_ ? reinterpret_cast<const value_type *>(base_ + kHeaderBytes)
+                 : nullptr;
+  }
+
+  // Iterators
+  iterator begin() noexcept { return data(); }
+
+  const_iterator begin() const noexcept { return data(); }
+
+  iterator end() noexcept { return data() + size_; }
+
+  const_iterator end() const noexcept { return data() + size_; }
+
+  // Lookup
+  // Arithmetic elements are scanned with SIMD where the CPU supports it.
+ public:
+  iterator find(const_reference value) noexcept {
+    return begin() + detail::simd::Find(data(), size_, value);
+  }
+
+  const_iterator find(const_reference value) const noexcept {
+    return begin() + detail::simd::Find(data(), size_, value);
+  }
+
+  size_type count(const_reference value) const noexcept {
+    return detail::simd::Count(data(), size_, value);
+  }
+
+  bool contains(const_reference value) const noexcept {
+    return find(value) != end();
+  }
+
+  const_reference min() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::mapped_vector::min Using methods on a zero sized container "
+          "results in the UB");
+    return data()[detail::simd::MinIndex(data(), size_)];
+  }
+
+  const_reference max() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::mapped_vector::max Using methods on a zero sized container "
+          "results in the UB");
+    return data()[detail::simd::MaxIndex(data(), size_)];
+  }
+
+  detail::simd::SumType<value_type> sum() const noexcept {
+    return detail::simd::Sum(data(), size_);
+  }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    size_type file_bytes = std::numeric_limits<off_t>::max();
+    return std::min(std::numeric_limits<size_type>::max() / sizeof(T) / 2,
+                    (file_bytes - kHeaderBytes) / sizeof(T));
+  }
+
+  void reserve(size_type new_cap) {
+    CheckWritable("reserve");
+    if (new_cap <= capacity_) return;
+
+    if (new_cap > max_size())
+      throw std::length_error(
+          "s21::mapped_vector::reserve Reserve capacity can't be larger than "
+          "max_size()");
+
+    Remap(new_cap);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  // Truncates the file to the elements it holds.
+  void shrink_to_fit() {
+    CheckWritable("shrink_to_fit");
+    size_type fit = GrowthPolicy::Fit(size_, sizeof(T));
+    if (fit < capacity_) Remap(fit);
+  }
+
+  void clear() {
+    CheckWritable("clear");
+    SetSize(0);
+  }
+
+  void resize(size_type count) { resize(count, value_type()); }
+
+  void resize(size_type count, const_reference value) {
+    value_type copy(value);
+    size_type old_size = size_;
+    resize_for_overwrite(count);
+    for (size_type pos = old_size; pos < count; ++pos) Store(pos, copy);
+  }
+
+  // Like resize(count), but the new elements hold whatever bytes the file
+  // has there, ready to be overwritten through data().
+  void resize_for_overwrite(size_type count) {
+    CheckWritable("resize");
+    if (count > capacity_) Remap(GrowCapacity(count));
+    SetSize(count);
+  }
+
+  // Modifiers
+ public:
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, size_type count, const_reference value) {
+    value_type copy(value);
+    size_type index = InsertIndex(pos, "insert");
+    OpenGap(index, count);
+    for (size_type i = index; i < index + count; ++i) Store(i, copy);
+    SetSize(size_ + count);
+    return begin() + index;
+  }
+
+  // [first, last) must not point into this vector.
+  template <typename InputIt, typename Category = typename std::iterator_traits<
+                                 InputIt>::iterator_category>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = InsertIndex(pos, "insert");
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      size_type count = std::distance(first, last);
+      OpenGap(index, count);
+      try {
+        for (size_type i = index; first != last; ++first, ++i) Store(i, *first);
+      } catch (...) {
+        std::memmove(static_cast<void *>(data() + index),
+                     data() + index + count, (size_ - index) * sizeof(T));
+        throw;
+      }
+      SetSize(size_ + count);
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) EmplaceAt(size_, *first);
+      std::rotate(begin() + index, begin() + old_size, end());
+    }
+    return begin() + index;
+  }
+
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename Range>
+  void append_range(const Range &range) {
+    insert(end(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    size_type index = InsertIndex(pos, "insert");
+    if constexpr (sizeof...(Args) != 0) {
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      OpenGap(index, sizeof...(Args));
+      std::memcpy(static_cast<void *>(data() + index), items, sizeof(items));
+      SetSize(size_ + sizeof...(Args));
+    }
+    return begin() + index;
+  }
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = InsertIndex(pos, "emplace");
+    return EmplaceAt(index, std::forward<Args>(args)...);
+  }
+
+  iterator erase(const_iterator pos) {
+    size_type index = pos - begin();
+    if (index >= size_)
+      throw std::out_of_range(
+          "s21::mapped_vector::erase Unable to erase a position out of range "
+          "of begin() to end()");
+    CheckWritable("erase");
+    CloseGap(index, 1);
+    return begin() + index;
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = first - begin();
+    size_type count = last - first;
+    if (first > last || index + count > size_)
+      throw std::out_of_range(
+          "s21::mapped_vector::erase Unable to erase a range out of range of "
+          "begin() to end()");
+    CheckWritable("erase");
+    CloseGap(index, count);
+    return begin() + index;
+  }
+
+  template <typename Predicate>
+  size_type remove_if(Predicate pred) {
+    CheckWritable("remove_if");
+    iterator write = std::remove_if(begin(), end(), pred);
+    size_type removed = end() - write;
+    SetSize(write - begin());
+    return removed;
+  }
+
+  void push_back(const_reference value) { EmplaceAt(size_, value); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *EmplaceAt(size_, std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::mapped_vector::pop_back Calling pop_back on an empty "
+          "container results in UB");
+    CheckWritable("pop_back");
+    SetSize(size_ - 1);
+  }
+
+  void swap(mapped_vector &other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(base_, other.base_);
+    std::swap(mapped_bytes_, other.mapped_bytes_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  int fd_ = -1;
+  unsigned char *base_ = nullptr;
+  size_type mapped_bytes_ = 0;
+  // Cached from the header, which only a writable vector updates.
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+
+  static std::system_error SystemError(const char *method) {
+    return std::system_error(
+        errno, std::generic_category(),
+        std::string("s21::mapped_vector::") + method + " System call failed");
+  }
+
+  static size_type BytesFor(size_type capacity) noexcept {
+    return kHeaderBytes + capacity * sizeof(T);
+  }
+
+  Header *header() const noexcept { return reinterpret_cast<Header *>(base_); }
+
+  void Open(const std::string &path) {
+    int flags = kReadOnly ? O_RDONLY : O_RDWR | O_CREAT;
+    fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd_ < 0) throw SystemError("open");
+
+    try {
+      struct stat info;
+      if (fstat(fd_, &info) != 0) throw SystemError("open");
+      size_type file_bytes = info.st_size;
+      if (file_bytes == 0 && !kReadOnly) {
+        Remap(0);
+        std::memcpy(header()->magic, kMagic, sizeof(kMagic));
+        header()->value_size = sizeof(T);
+        header()->size = 0;
+        return;
+      }
+
+      if (file_bytes < kHeaderBytes)
+        throw std::runtime_error(
+            "s21::mapped_vector::open The file is not a mapped_vector");
+      Map(file_bytes);
+      capacity_ = (file_bytes - kHeaderBytes) / sizeof(T);
+      const Header &stored = *header();
+      if (std::memcmp(stored.magic, kMagic, sizeof(kMagic)) != 0 ||
+          stored.value_size != sizeof(T) || stored.size > capacity_)
+        throw std::runtime_error(
+            "s21::mapped_vector::open The file does not hold a mapped_vector "
+            "of this element type");
+      size_ = stored.size;
+    } catch (...) {
+      Close();
+      throw;
+    }
+  }
+
+  void Close() noexcept {
+    if (base_) munmap(base_, mapped_bytes_);
+    if (fd_ >= 0) ::close(fd_);
+    base_ = nullptr;
+    fd_ = -1;
+    mapped_bytes_ = size_ = capacity_ = 0;
+  }
+
+  void Map(size_type bytes) {
+    int prot = kReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    void *base = mmap(nullptr, bytes, prot, MAP_SHARED, fd_, 0);
+    if (base == MAP_FAILED) throw SystemError("open");
+    base_ = static_cast<unsigned char *>(base);
+    mapped_bytes_ = bytes;
+  }
+
+  // Resizes the file and the mapping to new_capacity elements. Pages past
+  // the end of the file can't be touched, so the file grows before the
+  // mapping does and shrinks after it.
+  void Remap(size_type new_capacity) {
+    size_type bytes = BytesFor(new_capacity);
+    if (bytes > mapped_bytes_ && ftruncate(fd_, bytes) != 0)
+      throw SystemError("reserve");
+
+    if (base_) {
+#ifdef __linux__
+      void *moved = mremap(base_, mapped_bytes_, bytes, MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) throw SystemError("reserve");
+      base_ = static_cast<unsigned char *>(moved);
+      mapped_bytes_ = bytes;
+#else
+      munmap(base_, mapped_bytes_);
+      base_ = nullptr;
+      Map(bytes);
+#endif
+    } else {
+      Map(bytes);
+    }
+
+    if (bytes < BytesFor(capacity_) && ftruncate(fd_, bytes) != 0)
+      throw SystemError("shrink_to_fit");
+    capacity_ = new_capacity;
+  }
+
+  void CheckWritable(const char *method) const {
+    static_assert(!kReadOnly, "s21::mapped_vector<const T> is read-only");
+    if (!base_)
+      throw std::logic_error(std::string("s21::mapped_vector::") + method +
+                             " The vector is not attached to a file");
+  }
+
+  size_type GrowCapacity(size_type required) const {
+    size_type new_capacity = GrowthPolicy::Grow(capacity_, required, sizeof(T));
+    if (new_capacity > max_size())
+      throw std::length_error(
+          "s21::mapped_vector Capacity can't be larger than max_size()");
+    return new_capacity;
+  }
+
+  size_type InsertIndex(const_iterator pos, const char *method) const {
+    size_type index = pos - begin();
+    if (index > size_)
+      throw std::out_of_range(
+          std::string("s21::mapped_vector::") + method +
+          " Unable to insert into a position out of range of begin() to end()");
+    return index;
+  }
+
+  // Callers store new elements before they count them here, so a process
+  // that dies while appending leaves a file without half-written elements.
+  void SetSize(size_type size) noexcept {
+    size_ = size;
+    header()->size = size;
+  }
+
+  void Store(size_type pos, const_reference value) noexcept {
+    std::memcpy(static_cast<void *>(data() + pos), &value, sizeof(T));
+  }
+
+  // Makes room for count elements at index without counting them yet, the
+  // gap holds stale bytes.
+  void OpenGap(size_type index, size_type count) {
+    CheckWritable("insert");
+    if (count > max_size() - size_)
+      throw std::length_error(
+          "s21::mapped_vector::insert Size can't be larger than max_size()");
+    if (size_ + count > capacity_) Remap(GrowCapacity(size_ + count));
+    std::memmove(static_cast<void *>(data() + index + count), data() + index,
+                 (size_ - index) * sizeof(T));
+  }
+
+  void CloseGap(size_type index, size_type count) noexcept {
+    std::memmove(static_cast<void *>(data() + index), data() + index + count,
+                 (size_ - index - count) * sizeof(T));
+    SetSize(size_ - count);
+  }
+
+  // The new element is made before anything moves, args may refer to
+  // elements of this vector.
+  template <typename... Args>
+  iterator EmplaceAt(size_type index, Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    OpenGap(index, 1);
+    Store(index, value);
+    SetSize(size_ + 1);
+    return begin() + index;
+  }
+};
+
+template <typename T, typename GrowthPolicy, typename Predicate>
+std::size_t erase_if(mapped_vector<T, GrowthPolicy> &v, Predicate pred) {
+  return v.remove_if(pred);
+}
+
+template <typename T, typename GrowthPolicy, typename U>
+std::size_t erase(mapped_vector<T, GrowthPolicy> &v, const U &value) {
+  return v.remove_if([&value](const T &item) { return item == value; });
+}
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_MAPPED_VECTOR_H_
@@ -0,0 +1,389 @@
+#ifndef CPP2_S21_CONTAINERS_S21_PERSISTENT_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_PERSISTENT_VECTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "common/span.h"
+#include "s21_static_vector.h"
+
+namespace s21 {
+
+// Vector with value semantics whose copies share structure. The elements
+// live in 32-wide chunks at the leaves of a radix-balanced tree, the last
+// chunk (the tail) is kept outside the tree so that push_back usually only
+// touches it.
+//
+//  - Copying, or snapshot(), is O(1): it shares the tree, so a snapshot of a
+//    huge vector costs a few pointers, and readers on other threads may keep
+//    it while the original goes on changing.
+//  - operator[], set(), push_back() and pop_back() are O(log32 n). A change
+//    copies only the path from the root to the chunk it touches, and only
+//    the parts of it that are still shared with some other copy; nodes owned
+//    by this vector alone are updated in place.
+//  - Iteration walks one chunk at a time, for_each_chunk() hands the chunks
+//    out as contiguous spans.
+//
+// Distinct copies may be used from different threads, a single object is
+// not thread safe.
+template <typename T>
+class persistent_vector {
+  static constexpr std::size_t kBits = 5;
+  static constexpr std::size_t kWidth = std::size_t(1) << kBits;
+  static constexpr std::size_t kMask = kWidth - 1;
+
+  // Nodes are only ever created by make_shared of the concrete type, which
+  // destroys them correctly through a NodePtr without a virtual destructor.
+  struct Node {};
+  using NodePtr = std::shared_ptr<Node>;
+
+  struct Leaf : Node {
+    static_vector<T, kWidth> items;
+  };
+
+  struct Branch : Node {
+    static_vector<NodePtr, kWidth> children;
+  };
+
+ public:
+  class const_iterator;
+
+  using value_type = T;
+  using reference = const T &;
+  using const_reference = const T &;
+  using iterator = const_iterator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_type chunk_size = kWidth;
+
+  // Member functions
+ public:
+  persistent_vector() {}
+
+  persistent_vector(std::initializer_list<value_type> const &items)
+      : persistent_vector(items.begin(), items.end()) {}
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::pointer>
+  persistent_vector(InputIt first, InputIt last) {
+    for (; first != last; ++first) push_back(*first);
+  }
+
+  persistent_vector(const persistent_vector &other) = default;
+
+  persistent_vector(persistent_vector &&other) noexcept
+      : root_(std::move(other.root_)),
+        tail_(std::move(other.tail_)),
+        size_(std::exchange(other.size_, 0)),
+        shift_(std::exchange(other.shift_, kBits)) {}
+
+  persistent_vector &operator=(const persistent_vector &other) = default;
+
+  persistent_vector &operator=(persistent_vector &&other) noexcept {
+    persistent_vector(std::move(other)).swap(*this);
+    return *this;
+  }
+
+  // An O(1) copy that later changes to this vector won't affect.
+  persistent_vector snapshot() const { return *this; }
+
+  // Element Access
+ public:
+  const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::persistent_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  // Never checked, use at() for checked access.
+  const_reference operator[](size_type pos) const noexcept {
+    return LeafFor(pos)->items[pos & kMask];
+  }
+
+  const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::persistent_vector::front Using methods on a zero sized "
+          "container results in the UB");
+    return (*this)[0];
+  }
+
+  const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::persistent_vector::back Using methods on a zero sized "
+          "container results in the UB");
+    return (*this)[size_ - 1];
+  }
+
+  // Iterators
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+  // Calls f(span<const T>) on each chunk in order, at most 32 elements each.
+  template <typename Function>
+  void for_each_chunk(Function f) const {
+    for (size_type pos = 0; pos < size_; pos += kWidth) {
+      const Leaf *leaf = LeafFor(pos);
+      f(span<const T>(leaf->items.data(), leaf->items.size()));
+    }
+  }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  // Modifiers
+ public:
+  void clear() noexcept {
+    root_.reset();
+    tail_.reset();
+    size_ = 0;
+    shift_ = kBits;
+  }
+
+  void set(size_type pos, const_reference value) { SetAt(pos, value); }
+
+  void set(size_type pos, value_type &&value) { SetAt(pos, std::move(value)); }
+
+  void push_back(const_reference value) { Append(value); }
+
+  void push_back(value_type &&value) { Append(std::move(value)); }
+
+  void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::persistent_vector::pop_back Calling pop_back on an empty "
+          "container results in UB");
+    if (size_ == 1) {
+      clear();
+      return;
+    }
+    if (size_ - TailOffset() > 1) {
+      MutableLeaf(tail_)->items.pop_back();
+      --size_;
+      return;
+    }
+
+    // The tail empties out, the last chunk of the tree takes its place.
+    NodePtr new_tail = LeafPtrFor(size_ - 2);
+    PopTail(shift_, root_);
+    Branch *root = AsBranch(root_);
+    if (root->children.empty()) {
+      root_.reset();
+    } else if (shift_ > kBits && root->children.size() == 1) {
+      NodePtr child = root->children[0];
+      root_ = std::move(child);
+      shift_ -= kBits;
+    }
+    tail_ = std::move(new_tail);
+    --size_;
+  }
+
+  void swap(persistent_vector &other) noexcept {
+    root_.swap(other.root_);
+    tail_.swap(other.tail_);
+    std::swap(size_, other.size_);
+    std::swap(shift_, other.shift_);
+  }
+
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T &;
+    using pointer = const T *;
+
+    const_iterator() noexcept = default;
+
+    reference operator*() const noexcept { return chunk_[pos_ & kMask]; }
+
+    pointer operator->() const noexcept { return chunk_ + (pos_ & kMask); }
+
+    // The chunk is looked up once per 32 elements.
+    const_iterator &operator++() noexcept {
+      if ((++pos_ & kMask) == 0) Load();
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const const_iterator &other) const noexcept {
+      return pos_ == other.pos_;
+    }
+
+    bool operator!=(const const_iterator &other) const noexcept {
+      return pos_ != other.pos_;
+    }
+
+   private:
+    friend class persistent_vector;
+
+    const_iterator(const persistent_vector *owner, size_type pos) noexcept
+        : owner_(owner), pos_(pos) {
+      Load();
+    }
+
+    void Load() noexcept {
+      if (pos_ < owner_->size_) chunk_ = owner_->LeafFor(pos_)->items.data();
+    }
+
+    const persistent_vector *owner_ = nullptr;
+    size_type pos_ = 0;
+    const T *chunk_ = nullptr;
+  };
+
+ private:
+  NodePtr root_;
+  NodePtr tail_;
+  size_type size_ = 0;
+  // Bit offset of the child index within the root, kBits when the root's
+  // children are leaves.
+  size_type shift_ = kBits;
+
+  static Leaf *AsLeaf(const NodePtr &node) noexcept {
+    return static_cast<Leaf *>(node.get());
+  }
+
+  static Branch *AsBranch(const NodePtr &node) noexcept {
+    return static_cast<Branch *>(node.get());
+  }
+
+  // First index held by the tail rather than the tree.
+  size_type TailOffset() const noexcept {
+    return size_ < kWidth ? 0 : (size_ - 1) & ~kMask;
+  }
+
+  const Leaf *LeafFor(size_type pos) const noexcept {
+    if (pos >= TailOffset()) return AsLeaf(tail_);
+    const Node *node = root_.get();
+    for (size_type level = shift_; level > 0; level -= kBits)
+      node = static_cast<const Branch *>(node)
+                 ->children[(pos >> level) & kMask]
+                 .get();
+    return static_cast<const Leaf *>(node);
+  }
+
+  NodePtr LeafPtrFor(size_type pos) const {
+    const NodePtr *node = &root_;
+    for (size_type level = shift_; level > 0; level -= kBits)
+      node = &AsBranch(*node)->children[(pos >> level) & kMask];
+    return *node;
+  }
+
+  // A node may be changed in place only if nothing else refers to it. Nodes
+  // are only reached through parents that have been made exclusive first,
+  // and copying a parent bumps the count of every child, so use_count() is
+  // enough. The fence orders our writes after the reads of copies that have
+  // just released the node.
+  static bool IsExclusive(const NodePtr &node) noexcept {
+    if (node.use_count() != 1) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+
+  static Leaf *MutableLeaf(NodePtr &node) {
+    if (!node)
+      node = std::make_shared<Leaf>();
+    else if (!IsExclusive(node))
+      node = std::make_shared<Leaf>(*AsLeaf(node));
+    return AsLeaf(node);
+  }
+
+  static Branch *MutableBranch(NodePtr &node) {
+    if (!node)
+      node = std::make_shared<Branch>();
+    else if (!IsExclusive(node))
+      node = std::make_shared<Branch>(*AsBranch(node));
+    return AsBranch(node);
+  }
+
+  template <typename Value>
+  void SetAt(size_type pos, Value &&value) {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::persistent_vector::set The index is out of range");
+
+    NodePtr *node = &tail_;
+    if (pos < TailOffset()) {
+      node = &root_;
+      for (size_type level = shift_; level > 0; level -= kBits)
+        node = &MutableBranch(*node)->children[(pos >> level) & kMask];
+    }
+    MutableLeaf(*node)->items[pos & kMask] = std::forward<Value>(value);
+  }
+
+  template <typename Value>
+  void Append(Value &&value) {
+    if (size_ - TailOffset() < kWidth) {
+      MutableLeaf(tail_)->items.push_back(std::forward<Value>(value));
+    } else {
+      NodePtr leaf = std::make_shared<Leaf>();
+      AsLeaf(leaf)->items.push_back(std::forward<Value>(value));
+      PushTail();
+      tail_ = std::move(leaf);
+    }
+    ++size_;
+  }
+
+  // Moves the full tail into the tree, adding a level when the root is full.
+  void PushTail() {
+    if ((size_ >> kBits) > (size_type(1) << shift_)) {
+      NodePtr root = std::make_shared<Branch>();
+      AsBranch(root)->children.push_back(root_);
+      AsBranch(root)->children.push_back(NewPath(shift_, tail_));
+      root_ = std::move(root);
+      shift_ += kBits;
+    } else {
+      PushTail(shift_, root_);
+    }
+  }
+
+  void PushTail(size_type level, NodePtr &node) {
+    Branch *branch = MutableBranch(node);
+    size_type index = ((size_ - 1) >> level) & kMask;
+    if (level == kBits)
+      branch->children.push_back(tail_);
+    else if (index < branch->children.size())
+      PushTail(level - kBits, branch->children[index]);
+    else
+      branch->children.push_back(NewPath(level - kBits, tail_));
+  }
+
+  static NodePtr NewPath(size_type level, const NodePtr &leaf) {
+    if (level == 0) return leaf;
+    NodePtr branch = std::make_shared<Branch>();
+    AsBranch(branch)->children.push_back(NewPath(level - kBits, leaf));
+    return branch;
+  }
+
+  // Drops the last chunk of the tree, along with branches left empty.
+  void PopTail(size_type level, NodePtr &node) {
+    Branch *branch = MutableBranch(node);
+    if (level > kBits) {
+      NodePtr &child = branch->children[((size_ - 2) >> level) & kMask];
+      PopTail(level - kBits, child);
+      if (!AsBranch(child)->children.empty()) return;
+    }
+    branch->children.pop_back();
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_PERSISTENT_VECTOR_H_
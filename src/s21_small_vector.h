@@ -0,0 +1,411 @@
+#ifndef CPP2_S21_CONTAINERS_S21_SMALL_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "common/relocate.h"
+
+namespace s21 {
+
+// Vector that keeps its first N elements inside the object and only goes to
+// the heap once it grows past N. The public API mirrors s21::vector.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class small_vector {
+  static_assert(N > 0, "s21::small_vector needs room for at least one item");
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  // Member functions
+ public:
+  small_vector() {}
+
+  explicit small_vector(const allocator_type &alloc) : allocator_(alloc) {}
+
+  explicit small_vector(size_type size,
+                        const allocator_type &alloc = allocator_type())
+      : allocator_(alloc) {
+    Initialize([&] {
+      reserve(size);
+      for (; size_ < size; ++size_) Construct(buffer_ + size_);
+    });
+  }
+
+  small_vector(std::initializer_list<value_type> const &init,
+               const allocator_type &alloc = allocator_type())
+      : small_vector(init.begin(), init.end(), alloc) {}
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::pointer>
+  small_vector(InputIt first, InputIt last,
+               const allocator_type &alloc = allocator_type())
+      : allocator_(alloc) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    Initialize([&] {
+      if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
+        reserve(std::distance(first, last));
+      for (; first != last; ++first) push_back(*first);
+    });
+  }
+
+  small_vector(const small_vector &v)
+      : allocator_(
+            alloc_traits::select_on_container_copy_construction(v.allocator_)) {
+    Initialize([&] {
+      reserve(v.size_);
+      for (const auto &item : v) {
+        Construct(buffer_ + size_, item);
+        ++size_;
+      }
+    });
+  }
+
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : allocator_(std::move(v.allocator_)) {
+    StealFrom(v);
+  }
+
+  ~small_vector() { RemoveVector(); }
+
+  small_vector &operator=(small_vector &&rhs) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &rhs) {
+      RemoveVector();
+      allocator_ = std::move(rhs.allocator_);
+      StealFrom(rhs);
+    }
+
+    return *this;
+  }
+
+  small_vector &operator=(const small_vector &rhs) {
+    if (this != &rhs) {
+      clear();
+      reserve(rhs.size_);
+      for (const auto &item : rhs) {
+        Construct(buffer_ + size_, item);
+        ++size_;
+      }
+    }
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_; }
+
+  // Element Access
+ public:
+  reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::small_vector::at The index is out of range");
+
+    return buffer_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::small_vector::at The index is out of range");
+
+    return buffer_[pos];
+  }
+
+  // Never checked, use at() for checked access.
+  reference operator[](size_type pos) noexcept { return buffer_[pos]; }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return buffer_[pos];
+  }
+
+  reference front() {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::small_vector::front Using methods on a zero sized container "
+          "results in the UB");
+    return *begin();
+  }
+
+  const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::small_vector::front Using methods on a zero sized container "
+          "results in the UB");
+    return *begin();
+  }
+
+  reference back() {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::small_vector::back Using methods on a zero sized container "
+          "results in the UB");
+    return *std::prev(end());
+  }
+
+  const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::small_vector::back Using methods on a zero sized container "
+          "results in the UB");
+    return *std::prev(end());
+  }
+
+  iterator data() noexcept { return buffer_; }
+
+  const_iterator data() const noexcept { return buffer_; }
+
+  // Iterators
+  iterator begin() noexcept { return buffer_; }
+
+  const_iterator begin() const noexcept { return buffer_; }
+
+  iterator end() noexcept { return buffer_ + size_; }
+
+  const_iterator end() const noexcept { return buffer_ + size_; }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  // True while the elements still live in the inline buffer.
+  bool is_inline() const noexcept { return buffer_ == InlineBuffer(); }
+
+  static constexpr size_type inline_capacity() noexcept { return N; }
+
+  void reserve(size_type new_cap) {
+    if (new_cap <= capacity_) return;
+
+    if (new_cap > max_size())
+      throw std::length_error(
+          "s21::small_vector::reserve Reserve capacity can't be larger than "
+          "max_size()");
+
+    ReallocVector(new_cap);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  void shrink_to_fit() {
+    if (is_inline() || capacity_ == size_) return;
+
+    ReallocVector(size_);
+  }
+
+  void clear() noexcept { DestroyTail(0); }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    size_type index = pos - begin();
+    if (index > size_)
+      throw std::out_of_range(
+          "s21::small_vector::insert Unable to insert into a position out of "
+          "range of begin() to end()");
+
+    return EmplaceAt(index, std::move(value));
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    size_type index = pos - begin();
+    if (index > size_)
+      throw std::out_of_range(
+          "s21::small_vector::insert Unable to insert into a position out of "
+          "range of begin() to end()");
+
+    return EmplaceAt(index, value);
+  }
+
+  iterator erase(const_iterator pos) {
+    size_type index = pos - begin();
+    if (index >= size_)
+      throw std::out_of_range(
+          "s21::small_vector::erase Unable to erase a position out of range "
+          "of begin() to end()");
+
+    detail::ShiftElements(buffer_ + index + 1, end(), buffer_ + index);
+    DestroyTail(size_ - 1);
+    return begin() + index;
+  }
+
+  void push_back(const_reference value) { EmplaceAt(size_, value); }
+
+  void push_back(value_type &&value) { EmplaceAt(size_, std::move(value)); }
+
+  void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::small_vector::pop_back Calling pop_back on an empty container "
+          "results in UB");
+    DestroyTail(size_ - 1);
+  }
+
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this == &other) return;
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(allocator_, other.allocator_);
+      std::swap(buffer_, other.buffer_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    } else {
+      small_vector tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+  }
+
+ private:
+  alignas(value_type) unsigned char storage_[N * sizeof(value_type)];
+  allocator_type allocator_;
+  size_type size_ = 0;
+  size_type capacity_ = N;
+  iterator buffer_ = InlineBuffer();
+
+  iterator InlineBuffer() noexcept {
+    return reinterpret_cast<iterator>(storage_);
+  }
+
+  const_iterator InlineBuffer() const noexcept {
+    return reinterpret_cast<const_iterator>(storage_);
+  }
+
+  template <typename... Args>
+  void Construct(iterator where, Args &&...args) {
+    alloc_traits::construct(allocator_, where, std::forward<Args>(args)...);
+  }
+
+  void DestroyTail(size_type new_size) noexcept {
+    detail::Destroy(allocator_, buffer_ + new_size, buffer_ + size_);
+    size_ = new_size;
+  }
+
+  // Runs build, which fills a freshly constructed vector. The destructor
+  // doesn't run when a constructor throws, so whatever build managed to
+  // construct is torn down here.
+  template <typename Build>
+  void Initialize(Build build) {
+    try {
+      build();
+    } catch (...) {
+      RemoveVector();
+      throw;
+    }
+  }
+
+  void RemoveVector() noexcept {
+    DestroyTail(0);
+    if (!is_inline()) alloc_traits::deallocate(allocator_, buffer_, capacity_);
+    buffer_ = InlineBuffer();
+    capacity_ = N;
+  }
+
+  // Takes over the contents of an other vector. A heap buffer is stolen as
+  // is, inline elements have to be relocated one by one.
+  void StealFrom(small_vector &other) {
+    if (other.is_inline()) {
+      detail::Relocate(allocator_, other.begin(), other.end(), buffer_);
+      size_ = std::exchange(other.size_, 0);
+    } else {
+      buffer_ = std::exchange(other.buffer_, other.InlineBuffer());
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, N);
+    }
+  }
+
+  size_type GrowCapacity() const {
+    size_type new_capacity = size_ * 2;
+    if (new_capacity > max_size())
+      throw std::length_error(
+          "s21::small_vector Capacity can't be larger than max_size()");
+    return new_capacity;
+  }
+
+  // Moves the elements to a buffer of new_capacity, which is the inline one
+  // whenever it is large enough.
+  void ReallocVector(size_type new_capacity) {
+    bool to_inline = new_capacity <= N;
+    iterator tmp = to_inline ? InlineBuffer()
+                             : alloc_traits::allocate(allocator_, new_capacity);
+    if (tmp == buffer_) return;
+    try {
+      detail::Relocate(allocator_, begin(), end(), tmp);
+    } catch (...) {
+      if (!to_inline) alloc_traits::deallocate(allocator_, tmp, new_capacity);
+      throw;
+    }
+
+    if (!is_inline()) alloc_traits::deallocate(allocator_, buffer_, capacity_);
+    buffer_ = tmp;
+    capacity_ = to_inline ? N : new_capacity;
+  }
+
+  template <typename... Args>
+  iterator EmplaceAt(size_type index, Args &&...args) {
+    if (size_ == capacity_) {
+      // The new element is built before the old buffer is touched, so args
+      // may safely refer to elements of this vector.
+      size_type new_capacity = GrowCapacity();
+      iterator tmp = alloc_traits::allocate(allocator_, new_capacity);
+      int stage = 0;
+      try {
+        Construct(tmp + index, std::forward<Args>(args)...);
+        stage = 1;
+        detail::UninitializedMove(allocator_, begin(), begin() + index, tmp);
+        stage = 2;
+        detail::UninitializedMove(allocator_, begin() + index, end(),
+                                  tmp + index + 1);
+      } catch (...) {
+        if (stage == 2) detail::Destroy(allocator_, tmp, tmp + index);
+        if (stage >= 1)
+          detail::Destroy(allocator_, tmp + index, tmp + index + 1);
+        alloc_traits::deallocate(allocator_, tmp, new_capacity);
+        throw;
+      }
+      detail::Destroy(allocator_, begin(), end());
+
+      if (!is_inline())
+        alloc_traits::deallocate(allocator_, buffer_, capacity_);
+      buffer_ = tmp;
+      capacity_ = new_capacity;
+    } else if (index == size_) {
+      Construct(end(), std::forward<Args>(args)...);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      if constexpr (detail::kIsTriviallyRelocatable<value_type>) {
+        detail::ShiftElements(begin() + index, end(), begin() + index + 1);
+      } else {
+        Construct(end(), std::move(*(end() - 1)));
+        detail::ShiftElements(begin() + index, end() - 1, begin() + index + 1);
+      }
+      buffer_[index] = std::move(value);
+    }
+
+    ++size_;
+    return begin() + index;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_SMALL_VECTOR_H_
@@ -0,0 +1,257 @@
+#ifndef CPP2_S21_CONTAINERS_S21_SOA_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_SOA_VECTOR_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/index_iterator.h"
+#include "common/span.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Struct-of-arrays container: the I-th field of every row lives in the I-th
+// column, a contiguous s21::vector<Ts...[I]>. All columns always hold the
+// same number of elements and are reserved together, so they grow at the
+// same moments. column<I>() gives a span over one field for columnar scans,
+// operator[] and the iterators give zipped rows as tuples of references.
+template <typename... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "s21::soa_vector needs at least one field");
+  static_assert((!std::is_same_v<Ts, bool> && ...),
+                "s21::soa_vector bool columns would be bit-packed and have no "
+                "span, store flags as unsigned char");
+
+  using columns_type = std::tuple<vector<Ts>...>;
+  using indices = std::index_sequence_for<Ts...>;
+
+  // Bytes of one row, what the growth policy sees as the element size.
+  static constexpr std::size_t kRowBytes = (sizeof(Ts) + ...);
+
+ public:
+  using value_type = std::tuple<Ts...>;
+  using reference = std::tuple<Ts &...>;
+  using const_reference = std::tuple<const Ts &...>;
+  // Dereferencing yields a row, so
+  //   for (auto [id, price] : table) price *= 2;
+  // updates the table in place.
+  using iterator = detail::IndexIterator<soa_vector, reference>;
+  using const_iterator =
+      detail::IndexIterator<const soa_vector, const_reference>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr size_type field_count = sizeof...(Ts);
+
+  // Member functions
+ public:
+  soa_vector() {}
+
+  explicit soa_vector(size_type size) { resize(size); }
+
+  soa_vector(std::initializer_list<value_type> const &rows) {
+    reserve(rows.size());
+    for (const value_type &row : rows) push_back(row);
+  }
+
+  // Column access
+ public:
+  template <std::size_t I>
+  span<field_type<I>> column() noexcept {
+    auto &items = std::get<I>(columns_);
+    return span<field_type<I>>(items.data(), items.size());
+  }
+
+  template <std::size_t I>
+  span<const field_type<I>> column() const noexcept {
+    const auto &items = std::get<I>(columns_);
+    return span<const field_type<I>>(items.data(), items.size());
+  }
+
+  // Row access
+ public:
+  reference at(size_type pos) {
+    CheckIndex(pos);
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    CheckIndex(pos);
+    return (*this)[pos];
+  }
+
+  // Never checked, use at() for checked access.
+  reference operator[](size_type pos) noexcept {
+    return Row(pos, indices());
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return Row(pos, indices());
+  }
+
+  reference front() {
+    CheckNotEmpty("s21::soa_vector::front");
+    return (*this)[0];
+  }
+
+  const_reference front() const {
+    CheckNotEmpty("s21::soa_vector::front");
+    return (*this)[0];
+  }
+
+  reference back() {
+    CheckNotEmpty("s21::soa_vector::back");
+    return (*this)[size() - 1];
+  }
+
+  const_reference back() const {
+    CheckNotEmpty("s21::soa_vector::back");
+    return (*this)[size() - 1];
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+  iterator end() noexcept { return iterator(this, size()); }
+
+  const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept { return std::get<0>(columns_).size(); }
+
+  size_type capacity() const noexcept {
+    return std::get<0>(columns_).capacity();
+  }
+
+  void reserve(size_type new_cap) {
+    std::apply([new_cap](auto &...items) { (items.reserve(new_cap), ...); },
+               columns_);
+  }
+
+  void shrink_to_fit() {
+    std::apply([](auto &...items) { (items.shrink_to_fit(), ...); },
+               columns_);
+  }
+
+  // Modifiers
+ public:
+  void clear() noexcept {
+    std::apply([](auto &...items) { (items.clear(), ...); }, columns_);
+  }
+
+  // If a field's constructor throws, every column is shrunk back to the old
+  // size, so the table keeps its old rows.
+  void resize(size_type count) {
+    size_type old_size = size();
+    reserve(count);
+    try {
+      std::apply([count](auto &...items) { (items.resize(count), ...); },
+                 columns_);
+    } catch (...) {
+      std::apply([old_size](auto &...items) { (items.resize(old_size), ...); },
+                 columns_);
+      throw;
+    }
+  }
+
+  void push_back(const value_type &row) {
+    std::apply([this](const Ts &...fields) { emplace_back(fields...); }, row);
+  }
+
+  void push_back(value_type &&row) {
+    std::apply([this](Ts &...fields) { emplace_back(std::move(fields)...); },
+               row);
+  }
+
+  // Appends a row built from one argument per field.
+  template <typename... Args>
+  reference emplace_back(Args &&...fields) {
+    static_assert(sizeof...(Args) == sizeof...(Ts),
+                  "s21::soa_vector::emplace_back Needs one value per field");
+    Grow();
+    PushRow(indices(), std::forward<Args>(fields)...);
+    return (*this)[size() - 1];
+  }
+
+  void pop_back() {
+    if (empty())
+      throw std::length_error(
+          "s21::soa_vector::pop_back Calling pop_back on an empty container "
+          "results in UB");
+    std::apply([](auto &...items) { (items.pop_back(), ...); }, columns_);
+  }
+
+  // Removes row pos by shifting every column down once.
+  void erase(size_type pos) {
+    CheckIndex(pos);
+    std::apply(
+        [pos](auto &...items) { (items.erase(items.begin() + pos), ...); },
+        columns_);
+  }
+
+  void swap(soa_vector &other) noexcept { columns_.swap(other.columns_); }
+
+ private:
+  columns_type columns_;
+
+  template <std::size_t... I>
+  reference Row(size_type pos, std::index_sequence<I...>) noexcept {
+    return reference(std::get<I>(columns_)[pos]...);
+  }
+
+  template <std::size_t... I>
+  const_reference Row(size_type pos,
+                      std::index_sequence<I...>) const noexcept {
+    return const_reference(std::get<I>(columns_)[pos]...);
+  }
+
+  void CheckIndex(size_type pos) const {
+    if (pos >= size())
+      throw std::out_of_range("s21::soa_vector::at The index is out of range");
+  }
+
+  void CheckNotEmpty(const char *where) const {
+    if (empty())
+      throw std::out_of_range(std::string(where) +
+                              " Using methods on a zero sized container "
+                              "results in the UB");
+  }
+
+  // Reserves room for one more row in every column at once, so that the
+  // pushes of PushRow never reallocate.
+  void Grow() {
+    if (size() < capacity()) return;
+    reserve(growth::doubling::Grow(capacity(), size() + 1, kRowBytes));
+  }
+
+  // Pushes one field per column. If a field's constructor throws, the fields
+  // already pushed are popped again and the table keeps its old rows.
+  template <std::size_t... I, typename... Args>
+  void PushRow(std::index_sequence<I...>, Args &&...fields) {
+    std::size_t pushed = 0;
+    try {
+      ((std::get<I>(columns_).emplace_back(std::forward<Args>(fields)),
+        ++pushed),
+       ...);
+    } catch (...) {
+      ((I < pushed ? std::get<I>(columns_).pop_back() : void()), ...);
+      throw;
+    }
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_SOA_VECTOR_H_
@@ -0,0 +1,359 @@
+#ifndef CPP2_S21_CONTAINERS_S21_STATIC_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_STATIC_VECTOR_H_
+
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+
+// Storage of static_vector. Trivial types live in a plain array so that the
+// whole container stays a literal type usable in constant expressions,
+// everything else is placement-constructed into raw bytes.
+template <typename T, std::size_t N, bool = std::is_trivial_v<T>>
+class StaticVectorStorage {
+ protected:
+  constexpr T *Data() noexcept { return data_; }
+  constexpr const T *Data() const noexcept { return data_; }
+
+  template <typename... Args>
+  constexpr void Construct(std::size_t pos, Args &&...args) {
+    data_[pos] = T(std::forward<Args>(args)...);
+  }
+
+  constexpr void Destroy(std::size_t, std::size_t) noexcept {}
+
+  std::size_t size_ = 0;
+  T data_[N ? N : 1] = {};
+};
+
+template <typename T, std::size_t N>
+class StaticVectorStorage<T, N, false> {
+ public:
+  StaticVectorStorage() noexcept {}
+
+  StaticVectorStorage(const StaticVectorStorage &other) {
+    ConstructAll([&] {
+      for (; size_ < other.size_; ++size_)
+        Construct(size_, other.Data()[size_]);
+    });
+  }
+
+  StaticVectorStorage(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    ConstructAll([&] {
+      for (; size_ < other.size_; ++size_)
+        Construct(size_, std::move(other.Data()[size_]));
+    });
+    other.Destroy(0, other.size_);
+    other.size_ = 0;
+  }
+
+  StaticVectorStorage &operator=(const StaticVectorStorage &other) {
+    if (this != &other) {
+      Destroy(0, size_);
+      for (size_ = 0; size_ < other.size_; ++size_)
+        Construct(size_, other.Data()[size_]);
+    }
+    return *this;
+  }
+
+  StaticVectorStorage &operator=(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      Destroy(0, size_);
+      for (size_ = 0; size_ < other.size_; ++size_)
+        Construct(size_, std::move(other.Data()[size_]));
+      other.Destroy(0, other.size_);
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  ~StaticVectorStorage() { Destroy(0, size_); }
+
+ protected:
+  T *Data() noexcept { return std::launder(reinterpret_cast<T *>(raw_)); }
+  const T *Data() const noexcept {
+    return std::launder(reinterpret_cast<const T *>(raw_));
+  }
+
+  template <typename... Args>
+  void Construct(std::size_t pos, Args &&...args) {
+    ::new (static_cast<void *>(Data() + pos)) T(std::forward<Args>(args)...);
+  }
+
+  void Destroy(std::size_t first, std::size_t last) noexcept {
+    for (; first != last; ++first) Data()[first].~T();
+  }
+
+  std::size_t size_ = 0;
+  alignas(T) unsigned char raw_[sizeof(T) * (N ? N : 1)];
+
+ private:
+  // The destructor doesn't run when a constructor throws, so the elements
+  // build managed to construct are destroyed here.
+  template <typename Build>
+  void ConstructAll(Build build) {
+    try {
+      build();
+    } catch (...) {
+      Destroy(0, size_);
+      throw;
+    }
+  }
+};
+
+}  // namespace detail
+
+// Vector with a compile-time capacity N that never allocates. The checked
+// modifiers throw std::length_error on overflow, the try_ ones report it
+// through their return value instead. For trivial T every member function is
+// constexpr.
+template <typename T, std::size_t N>
+class static_vector : private detail::StaticVectorStorage<T, N> {
+  using base = detail::StaticVectorStorage<T, N>;
+  using base::Construct;
+  using base::Data;
+  using base::Destroy;
+  using base::size_;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  // Member functions
+ public:
+  constexpr static_vector() = default;
+
+  constexpr explicit static_vector(size_type size) {
+    CheckCapacity(size);
+    for (; size_ < size; ++size_) Construct(size_);
+  }
+
+  constexpr static_vector(std::initializer_list<value_type> const &init)
+      : static_vector(init.begin(), init.end()) {}
+
+  template <typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::pointer>
+  constexpr static_vector(InputIt first, InputIt last) {
+    for (; first != last; ++first) push_back(*first);
+  }
+
+  // Element Access
+ public:
+  constexpr reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::static_vector::at The index is out of range");
+
+    return Data()[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range(
+          "s21::static_vector::at The index is out of range");
+
+    return Data()[pos];
+  }
+
+  constexpr reference operator[](size_type pos) { return Data()[pos]; }
+
+  constexpr const_reference operator[](size_type pos) const {
+    return Data()[pos];
+  }
+
+  constexpr reference front() {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::static_vector::front Using methods on a zero sized container "
+          "results in the UB");
+    return Data()[0];
+  }
+
+  constexpr const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::static_vector::front Using methods on a zero sized container "
+          "results in the UB");
+    return Data()[0];
+  }
+
+  constexpr reference back() {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::static_vector::back Using methods on a zero sized container "
+          "results in the UB");
+    return Data()[size_ - 1];
+  }
+
+  constexpr const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range(
+          "s21::static_vector::back Using methods on a zero sized container "
+          "results in the UB");
+    return Data()[size_ - 1];
+  }
+
+  constexpr iterator data() noexcept { return Data(); }
+
+  constexpr const_iterator data() const noexcept { return Data(); }
+
+  // Iterators
+  constexpr iterator begin() noexcept { return Data(); }
+
+  constexpr const_iterator begin() const noexcept { return Data(); }
+
+  constexpr iterator end() noexcept { return Data() + size_; }
+
+  constexpr const_iterator end() const noexcept { return Data() + size_; }
+
+  // Capacity
+ public:
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr bool full() const noexcept { return size_ == N; }
+
+  constexpr size_type size() const noexcept { return size_; }
+
+  constexpr size_type max_size() const noexcept { return N; }
+
+  constexpr size_type capacity() const noexcept { return N; }
+
+  constexpr void reserve(size_type new_cap) const { CheckCapacity(new_cap); }
+
+  constexpr void shrink_to_fit() const noexcept {}
+
+  // Modifiers
+ public:
+  constexpr void clear() noexcept {
+    Destroy(0, size_);
+    size_ = 0;
+  }
+
+  constexpr iterator insert(const_iterator pos, const_reference value) {
+    CheckCapacity(size_ + 1);
+    return EmplaceAt(CheckedIndex(pos), value);
+  }
+
+  constexpr iterator insert(const_iterator pos, value_type &&value) {
+    CheckCapacity(size_ + 1);
+    return EmplaceAt(CheckedIndex(pos), std::move(value));
+  }
+
+  constexpr iterator erase(const_iterator pos) {
+    size_type index = pos - begin();
+    if (index >= size_)
+      throw std::out_of_range(
+          "s21::static_vector::erase Unable to erase a position out of "
+          "range of begin() to end()");
+
+    iterator items = Data();
+    for (size_type i = index; i + 1 < size_; ++i)
+      items[i] = std::move(items[i + 1]);
+    Destroy(size_ - 1, size_);
+    --size_;
+    return begin() + index;
+  }
+
+  constexpr void push_back(const_reference value) {
+    CheckCapacity(size_ + 1);
+    Construct(size_, value);
+    ++size_;
+  }
+
+  constexpr void push_back(value_type &&value) {
+    CheckCapacity(size_ + 1);
+    Construct(size_, std::move(value));
+    ++size_;
+  }
+
+  // Non-throwing push_back: returns false and leaves the vector untouched
+  // when it is full.
+  constexpr bool try_push_back(const_reference value) {
+    if (full()) return false;
+    Construct(size_, value);
+    ++size_;
+    return true;
+  }
+
+  constexpr bool try_push_back(value_type &&value) {
+    if (full()) return false;
+    Construct(size_, std::move(value));
+    ++size_;
+    return true;
+  }
+
+  // Non-throwing insert: returns end() when the vector is full. pos must be
+  // in [begin(), end()].
+  constexpr iterator try_insert(const_iterator pos, const_reference value) {
+    if (full()) return end();
+    return EmplaceAt(pos - begin(), value);
+  }
+
+  constexpr iterator try_insert(const_iterator pos, value_type &&value) {
+    if (full()) return end();
+    return EmplaceAt(pos - begin(), std::move(value));
+  }
+
+  constexpr void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::static_vector::pop_back Calling pop_back on an empty "
+          "container results in UB");
+    Destroy(size_ - 1, size_);
+    --size_;
+  }
+
+  constexpr void swap(static_vector &other) {
+    static_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  constexpr void CheckCapacity(size_type size) const {
+    if (size > N)
+      throw std::length_error(
+          "s21::static_vector Size can't be larger than the capacity");
+  }
+
+  constexpr size_type CheckedIndex(const_iterator pos) const {
+    size_type index = pos - begin();
+    if (index > size_)
+      throw std::out_of_range(
+          "s21::static_vector::insert Unable to insert into a position out "
+          "of range of begin() to end()");
+    return index;
+  }
+
+  template <typename... Args>
+  constexpr iterator EmplaceAt(size_type index, Args &&...args) {
+    if (index == size_) {
+      Construct(size_, std::forward<Args>(args)...);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      iterator items = Data();
+      Construct(size_, std::move(items[size_ - 1]));
+      for (size_type i = size_ - 1; i > index; --i)
+        items[i] = std::move(items[i - 1]);
+      items[index] = std::move(value);
+    }
+    ++size_;
+    return begin() + index;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_STATIC_VECTOR_H_
@@ -0,0 +1,526 @@
+#ifndef CPP2_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+#define CPP2_S21_CONTAINERS_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "common/aligned.h"
+#include "common/check_policy.h"
+#include "common/relocate.h"
+
+namespace s21 {
+
+// Doubly linked list of small arrays. Each block holds up to block_capacity
+// elements, as many as fit in two cache lines (at least four), so walking
+// the list touches one cache line after another like a vector does, while
+// inserting or erasing in the middle still only shifts the elements of one
+// block.
+//
+// A full block is split in half to make room, a block left at most half
+// full by an erase is merged with a neighbour if both fit in one, and empty
+// blocks are freed. Inserting and erasing invalidate the iterators
+// and references into the blocks involved, iterators into other blocks stay
+// valid. Like s21::list the blocks form a ring through a sentinel embedded
+// in the container, so an empty list allocates nothing.
+template <typename T, typename Allocator = std::allocator<T>,
+          typename CheckPolicy = check::throwing>
+class unrolled_list {
+  struct BlockBase {
+    BlockBase *next_ = nullptr;
+    BlockBase *prev_ = nullptr;
+    std::size_t count_ = 0;
+  };
+
+  static constexpr std::size_t kHeaderBytes = sizeof(BlockBase);
+  static constexpr std::size_t kMinCapacity = 4;
+
+ public:
+  static constexpr std::size_t block_capacity = std::max<std::size_t>(
+      (2 * kCacheLineBytes - kHeaderBytes) / sizeof(T), kMinCapacity);
+
+ private:
+  struct alignas(kCacheLineBytes) Block : BlockBase {
+    alignas(T) unsigned char storage_[block_capacity * sizeof(T)];
+
+    T *data() noexcept { return reinterpret_cast<T *>(storage_); }
+    const T *data() const noexcept {
+      return reinterpret_cast<const T *>(storage_);
+    }
+  };
+
+  template <bool IsConst>
+  class Iterator {
+    using block_pointer =
+        std::conditional_t<IsConst, const BlockBase *, BlockBase *>;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<IsConst, const T &, T &>;
+    using pointer = std::conditional_t<IsConst, const T *, T *>;
+
+    Iterator() noexcept = default;
+
+    // iterator converts to const_iterator.
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    Iterator(const Iterator<false> &other) noexcept
+        : block_(other.block_),
+          current_(other.current_),
+          last_(other.last_) {}
+
+    reference operator*() const noexcept { return *current_; }
+
+    pointer operator->() const noexcept { return current_; }
+
+    // Stepping within a block is a pointer increment and one compare, as for
+    // a vector.
+    Iterator &operator++() noexcept {
+      if (++current_ == last_) Enter(block_->next_, 0);
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      Iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    Iterator &operator--() noexcept {
+      if (!current_ || current_ == AsBlock(block_)->data())
+        Enter(block_->prev_, block_->prev_->count_);
+      --current_;
+      return *this;
+    }
+
+    Iterator operator--(int) noexcept {
+      Iterator old = *this;
+      --*this;
+      return old;
+    }
+
+    bool operator==(const Iterator &other) const noexcept {
+      return block_ == other.block_ && current_ == other.current_;
+    }
+
+    bool operator!=(const Iterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class unrolled_list;
+    template <bool>
+    friend class Iterator;
+
+    Iterator(block_pointer block, std::size_t index) noexcept {
+      Enter(block, index);
+    }
+
+    static auto AsBlock(block_pointer block) noexcept {
+      using block_type = std::conditional_t<IsConst, const Block, Block>;
+      return static_cast<block_type *>(block);
+    }
+
+    // Points at index of block, the sentinel is the only block without
+    // elements.
+    void Enter(block_pointer block, std::size_t index) noexcept {
+      block_ = block;
+      if (block->count_ == 0) {
+        current_ = last_ = nullptr;
+      } else {
+        current_ = AsBlock(block)->data() + index;
+        last_ = AsBlock(block)->data() + block->count_;
+      }
+    }
+
+    std::size_t Index() const noexcept {
+      return current_ ? current_ - AsBlock(block_)->data() : 0;
+    }
+
+    block_pointer block_ = nullptr;
+    pointer current_ = nullptr;
+    pointer last_ = nullptr;
+  };
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using checked_reference = typename CheckPolicy::template result<reference>;
+  using checked_const_reference =
+      typename CheckPolicy::template result<const_reference>;
+
+  // Member functions
+ public:
+  unrolled_list() : unrolled_list(allocator_type()) {}
+
+  explicit unrolled_list(const allocator_type &alloc) : block_alloc_(alloc) {
+    end_.next_ = end_.prev_ = &end_;
+  }
+
+  unrolled_list(std::initializer_list<value_type> const &items)
+      : unrolled_list() {
+    for (const_reference item : items) push_back(item);
+  }
+
+  unrolled_list(const unrolled_list &other)
+      : unrolled_list(block_traits::select_on_container_copy_construction(
+            other.block_alloc_)) {
+    for (const_reference item : other) push_back(item);
+  }
+
+  unrolled_list(unrolled_list &&other) noexcept
+      : unrolled_list(other.get_allocator()) {
+    swap(other);
+  }
+
+  unrolled_list &operator=(const unrolled_list &other) {
+    unrolled_list copy(other);
+    swap(copy);
+    return *this;
+  }
+
+  unrolled_list &operator=(unrolled_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~unrolled_list() { clear(); }
+
+  allocator_type get_allocator() const {
+    return allocator_type(block_alloc_);
+  }
+
+  // Element Access
+ public:
+  checked_reference front() {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<reference>(
+          access_error::empty, "unrolled_list::front() called with empty list");
+    return CheckPolicy::template Ok<reference>(*begin());
+  }
+
+  checked_const_reference front() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "unrolled_list::front() called with empty list");
+    return CheckPolicy::template Ok<const_reference>(*begin());
+  }
+
+  checked_reference back() {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<reference>(
+          access_error::empty, "unrolled_list::back() called with empty list");
+    return CheckPolicy::template Ok<reference>(*std::prev(end()));
+  }
+
+  checked_const_reference back() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty, "unrolled_list::back() called with empty list");
+    return CheckPolicy::template Ok<const_reference>(*std::prev(end()));
+  }
+
+  // Iterators
+  iterator begin() noexcept { return iterator(end_.next_, 0); }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(end_.next_, 0);
+  }
+
+  iterator end() noexcept { return iterator(&end_, 0); }
+
+  const_iterator end() const noexcept { return const_iterator(&end_, 0); }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(Block) *
+           block_capacity / 2;
+  }
+
+  // Number of blocks in use.
+  size_type block_count() const noexcept { return blocks_; }
+
+  // Modifiers
+ public:
+  void clear() noexcept {
+    while (end_.next_ != &end_) FreeBlock(AsBlock(end_.next_));
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // Inserts into the block of pos, or appends to the block before it when
+  // pos is the first element of a block, so runs of push_back fill whole
+  // blocks.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    BlockBase *base = const_cast<BlockBase *>(pos.block_);
+    size_type index = pos.Index();
+    if (index == 0 && base->prev_ != &end_) {
+      base = base->prev_;
+      index = AsBlock(base)->count_;
+    }
+
+    Block *block = base == &end_ ? nullptr : AsBlock(base);
+    if (!block || index == block_capacity) {
+      // Past the end of a full block: start a new one after it.
+      block = NewBlockBefore(block ? block->next_ : &end_);
+      index = 0;
+    } else if (index == 0 && block->count_ == block_capacity) {
+      // In front of a full first block: start a new one before it.
+      block = NewBlockBefore(block);
+    } else if (block->count_ == block_capacity) {
+      // The value is made before the split, args may refer to elements
+      // that are about to move.
+      value_type value(std::forward<Args>(args)...);
+      Block *upper = Split(block);
+      if (index > block->count_) {
+        index -= block->count_;
+        block = upper;
+      }
+      Emplace(block, index, std::move(value));
+      return iterator(block, index);
+    }
+
+    Emplace(block, index, std::forward<Args>(args)...);
+    return iterator(block, index);
+  }
+
+  // Returns the element that followed pos.
+  iterator erase(const_iterator pos) {
+    if (pos.block_ == &end_)
+      throw std::out_of_range(
+          "s21::unrolled_list::erase Unable to erase end()");
+    Block *block = AsBlock(const_cast<BlockBase *>(pos.block_));
+    size_type index = pos.Index();
+
+    T *data = block->data();
+    detail::ShiftElements(data + index + 1, data + block->count_,
+                          data + index);
+    block_traits::destroy(block_alloc_, data + --block->count_);
+    --size_;
+
+    if (block->count_ == 0) {
+      BlockBase *next = block->next_;
+      FreeBlock(block);
+      return iterator(next, 0);
+    }
+    if (block->count_ <= block_capacity / 2) {
+      Block *prev = block->prev_ == &end_ ? nullptr : AsBlock(block->prev_);
+      size_type offset = prev ? prev->count_ : 0;
+      if (prev && MergeNext(prev)) {
+        block = prev;
+        index += offset;
+      } else {
+        MergeNext(block);
+      }
+    }
+    if (index == block->count_) return iterator(block->next_, 0);
+    return iterator(block, index);
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  void push_front(const_reference value) { emplace_front(value); }
+
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    if (empty())
+      throw std::out_of_range(
+          "unrolled_list::pop_back() called with empty list");
+    erase(std::prev(end()));
+  }
+
+  void pop_front() {
+    if (empty())
+      throw std::out_of_range(
+          "unrolled_list::pop_front() called with empty list");
+    erase(begin());
+  }
+
+  // Moves the blocks of other in front of pos without copying elements,
+  // only the block of pos may be split. If the allocators differ, the
+  // elements are moved one by one instead.
+  void splice(const_iterator pos, unrolled_list &other) {
+    if (&other == this || other.empty()) return;
+    if constexpr (!block_traits::is_always_equal::value) {
+      if (block_alloc_ != other.block_alloc_) {
+        for (reference item : other)
+          pos = std::next(insert(pos, std::move(item)));
+        other.clear();
+        return;
+      }
+    }
+
+    BlockBase *before = const_cast<BlockBase *>(pos.block_);
+    if (pos.Index() != 0) before = Split(AsBlock(before), pos.Index());
+    BlockBase *first = other.end_.next_;
+    BlockBase *last = other.end_.prev_;
+    other.end_.next_ = other.end_.prev_ = &other.end_;
+
+    first->prev_ = before->prev_;
+    last->next_ = before;
+    before->prev_->next_ = first;
+    before->prev_ = last;
+    size_ += std::exchange(other.size_, 0);
+    blocks_ += std::exchange(other.blocks_, 0);
+  }
+
+  void swap(unrolled_list &other) noexcept {
+    std::swap(block_alloc_, other.block_alloc_);
+    std::swap(end_, other.end_);
+    std::swap(size_, other.size_);
+    std::swap(blocks_, other.blocks_);
+    AttachSentinel();
+    other.AttachSentinel();
+  }
+
+ private:
+  using block_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+  using block_traits = std::allocator_traits<block_allocator>;
+
+  block_allocator block_alloc_;
+  BlockBase end_;
+  size_type size_ = 0;
+  size_type blocks_ = 0;
+
+  static Block *AsBlock(BlockBase *block) noexcept {
+    return static_cast<Block *>(block);
+  }
+
+  void AttachSentinel() noexcept {
+    if (blocks_ == 0) {
+      end_.next_ = end_.prev_ = &end_;
+    } else {
+      end_.next_->prev_ = &end_;
+      end_.prev_->next_ = &end_;
+    }
+  }
+
+  Block *NewBlockBefore(BlockBase *pos) {
+    Block *block = block_traits::allocate(block_alloc_, 1);
+    // Default-initialized, so that the element storage isn't zeroed.
+    ::new (static_cast<void *>(block)) Block;
+    block->prev_ = pos->prev_;
+    block->next_ = pos;
+    pos->prev_->next_ = block;
+    pos->prev_ = block;
+    ++blocks_;
+    return block;
+  }
+
+  void FreeBlock(Block *block) noexcept {
+    detail::Destroy(block_alloc_, block->data(),
+                    block->data() + block->count_);
+    block->prev_->next_ = block->next_;
+    block->next_->prev_ = block->prev_;
+    block->~Block();
+    block_traits::deallocate(block_alloc_, block, 1);
+    --blocks_;
+  }
+
+  // Moves the elements from index on into a new block right after block.
+  Block *Split(Block *block, size_type index) {
+    Block *upper = NewBlockBefore(block->next_);
+    T *data = block->data();
+    try {
+      detail::Relocate(block_alloc_, data + index, data + block->count_,
+                       upper->data());
+    } catch (...) {
+      FreeBlock(upper);
+      throw;
+    }
+    upper->count_ = block->count_ - index;
+    block->count_ = index;
+    return upper;
+  }
+
+  Block *Split(Block *block) { return Split(block, block->count_ / 2); }
+
+  // Moves the elements of the next block to the end of block and frees the
+  // next block, if they fit.
+  bool MergeNext(Block *block) {
+    if (block->next_ == &end_) return false;
+    Block *next = AsBlock(block->next_);
+    if (block->count_ + next->count_ > block_capacity) return false;
+    detail::Relocate(block_alloc_, next->data(),
+                     next->data() + next->count_,
+                     block->data() + block->count_);
+    block->count_ += next->count_;
+    next->count_ = 0;
+    FreeBlock(next);
+    return true;
+  }
+
+  // Constructs an element at index of a block with room for it. The value
+  // is made before anything moves, args may refer to elements of the list.
+  template <typename... Args>
+  void Emplace(Block *block, size_type index, Args &&...args) {
+    T *data = block->data();
+    size_type count = block->count_;
+    if (index < count) {
+      value_type value(std::forward<Args>(args)...);
+      block_traits::construct(block_alloc_, data + count,
+                              std::move(data[count - 1]));
+      ++block->count_;
+      detail::ShiftElements(data + index, data + count - 1,
+                            data + index + 1);
+      data[index] = std::move(value);
+    } else {
+      try {
+        block_traits::construct(block_alloc_, data + count,
+                                std::forward<Args>(args)...);
+      } catch (...) {
+        if (count == 0) FreeBlock(block);
+        throw;
+      }
+      ++block->count_;
+    }
+    ++size_;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_UNROLLED_LIST_H_
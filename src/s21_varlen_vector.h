@@ -0,0 +1,182 @@
+#ifndef CPP2_S21_CONTAINERS_S21_VARLEN_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_VARLEN_VECTOR_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "common/index_iterator.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Packed sequence of variable-length byte strings. Every element lives back
+// to back in one byte arena and is located by its end offset, so the whole
+// container costs two buffers however many elements it holds, and element i
+// is read in O(1) as a std::string_view into the arena. Elements can't be
+// modified in place.
+//
+// Offset bounds the arena size: the default 32-bit offsets halve the index
+// memory and allow up to 4 GiB of data, std::size_t lifts the limit.
+template <typename Offset = std::uint32_t>
+class varlen_vector {
+  static_assert(std::is_unsigned_v<Offset>,
+                "s21::varlen_vector Offset must be an unsigned integer");
+
+ public:
+  using value_type = std::string_view;
+  using reference = std::string_view;
+  using const_reference = std::string_view;
+  using iterator = detail::IndexIterator<const varlen_vector, value_type>;
+  using const_iterator = iterator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using offset_type = Offset;
+
+  // Member functions
+ public:
+  varlen_vector() {}
+
+  varlen_vector(std::initializer_list<std::string_view> const &items) {
+    size_type bytes = 0;
+    for (std::string_view item : items) bytes += item.size();
+    reserve(items.size());
+    reserve_bytes(bytes);
+    for (std::string_view item : items) push_back(item);
+  }
+
+  // Element Access
+ public:
+  std::string_view at(size_type pos) const {
+    if (pos >= size())
+      throw std::out_of_range(
+          "s21::varlen_vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  // Never checked, use at() for checked access.
+  std::string_view operator[](size_type pos) const noexcept {
+    size_type first = pos ? ends_[pos - 1] : 0;
+    return std::string_view(arena_.data() + first, ends_[pos] - first);
+  }
+
+  std::string_view front() const {
+    if (empty())
+      throw std::out_of_range(
+          "s21::varlen_vector::front Using methods on a zero sized container "
+          "results in the UB");
+    return (*this)[0];
+  }
+
+  std::string_view back() const {
+    if (empty())
+      throw std::out_of_range(
+          "s21::varlen_vector::back Using methods on a zero sized container "
+          "results in the UB");
+    return (*this)[size() - 1];
+  }
+
+  // The arena, all elements concatenated.
+  std::string_view bytes() const noexcept {
+    return std::string_view(arena_.data(), arena_.size());
+  }
+
+  // Iterators
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+
+  const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return ends_.empty(); }
+
+  size_type size() const noexcept { return ends_.size(); }
+
+  size_type max_bytes() const noexcept {
+    return std::min<size_type>(arena_.max_size(),
+                               std::numeric_limits<offset_type>::max());
+  }
+
+  // Room for new_cap elements in the offset index.
+  void reserve(size_type new_cap) { ends_.reserve(new_cap); }
+
+  size_type capacity() const noexcept { return ends_.capacity(); }
+
+  // Room for new_cap bytes of element data in the arena. Reserving both
+  // up front makes loading a known data set cost exactly two allocations.
+  void reserve_bytes(size_type new_cap) {
+    if (new_cap > max_bytes())
+      throw std::length_error(
+          "s21::varlen_vector::reserve_bytes Arena can't be larger than "
+          "max_bytes()");
+    arena_.reserve(new_cap);
+  }
+
+  size_type capacity_bytes() const noexcept { return arena_.capacity(); }
+
+  void shrink_to_fit() {
+    ends_.shrink_to_fit();
+    arena_.shrink_to_fit();
+  }
+
+  // Modifiers
+ public:
+  void clear() noexcept {
+    ends_.clear();
+    arena_.clear();
+  }
+
+  // Appends a copy of item, which may point into this container.
+  void push_back(std::string_view item) {
+    size_type first = arena_.size();
+    if (item.size() > max_bytes() - first)
+      throw std::length_error(
+          "s21::varlen_vector::push_back Arena can't be larger than "
+          "max_bytes()");
+
+    // Growing the arena would invalidate an item that is part of it.
+    const char *source = item.data();
+    std::less<const char *> before;
+    bool inside = !before(source, arena_.data()) &&
+                  before(source, arena_.data() + arena_.size());
+    size_type source_offset = inside ? source - arena_.data() : 0;
+
+    ends_.push_back(offset_type(first + item.size()));
+    try {
+      arena_.resize_for_overwrite(first + item.size());
+    } catch (...) {
+      ends_.pop_back();
+      throw;
+    }
+    if (inside) source = arena_.data() + source_offset;
+    if (!item.empty()) std::memcpy(arena_.data() + first, source, item.size());
+  }
+
+  void pop_back() {
+    if (empty())
+      throw std::length_error(
+          "s21::varlen_vector::pop_back Calling pop_back on an empty "
+          "container results in UB");
+    ends_.pop_back();
+    arena_.resize(empty() ? 0 : ends_.back());
+  }
+
+  void swap(varlen_vector &other) noexcept {
+    arena_.swap(other.arena_);
+    ends_.swap(other.ends_);
+  }
+
+ private:
+  vector<char> arena_;
+  vector<offset_type> ends_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_VARLEN_VECTOR_H_
@@ -5,63 +5,103 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "common/aligned.h"
+#include "common/allocator_holder.h"
+#include "common/check_policy.h"
+#include "common/relocate.h"
+#include "common/simd.h"
+#include "vector/growth_policy.h"
+#include "vector/remap_allocator.h"
+
 namespace s21 {
 
-template <typename T>
-class vector {
+// GrowthPolicy picks the capacity the vector grows to, see
+// vector/growth_policy.h for the available ones. CheckPolicy decides how
+// at(), front() and back() treat an invalid access, see
+// common/check_policy.h.
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = growth::doubling,
+          typename CheckPolicy = check::throwing>
+class vector : private detail::AllocatorHolder<Allocator> {
+  using allocator_holder = detail::AllocatorHolder<Allocator>;
+
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
   using const_iterator = const T *;
   using size_type = std::size_t;
   using difference_type = std::ptrdiff_t;
+  using checked_reference = typename CheckPolicy::template result<reference>;
+  using checked_const_reference =
+      typename CheckPolicy::template result<const_reference>;
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  // Trivially copyable elements may be resized in place by allocators that
+  // provide reallocate(), such as s21::remap_allocator.
+  static constexpr bool kReallocInPlace =
+      detail::kIsTriviallyRelocatable<T> &&
+      detail::kHasReallocate<allocator_type>;
 
   // Member functions
  public:
   vector() {}
 
-  explicit vector(size_type size) {
-    size_ = size;
-    capacity_ = size;
-    buffer_ = nullptr;
-    if (size > 0) {
-      buffer_ = new value_type[capacity_];
-    }
+  explicit vector(const allocator_type &alloc) : allocator_holder(alloc) {}
+
+  explicit vector(size_type size,
+                  const allocator_type &alloc = allocator_type())
+      : allocator_holder(alloc) {
+    Initialize(size, [&] {
+      for (; size_ < size; ++size_) Construct(buffer_ + size_);
+    });
   }
 
-  explicit vector(std::initializer_list<value_type> const &init)
-      : size_{init.size()},
-        capacity_(init.size()),
-        buffer_{new value_type[capacity_]} {
-    std::copy(init.begin(), init.end(), buffer_);
+  explicit vector(std::initializer_list<value_type> const &init,
+                  const allocator_type &alloc = allocator_type())
+      : allocator_holder(alloc) {
+    Initialize(init.size(), [&] {
+      for (const auto &item : init) {
+        Construct(buffer_ + size_, item);
+        ++size_;
+      }
+    });
   }
 
-  vector(const vector &v) {
-    size_ = v.size_;
-    capacity_ = v.capacity_;
-    buffer_ = nullptr;
-    if (size_ > 0) {
-      buffer_ = new value_type[capacity_];
-    }
-    std::copy(v.begin(), v.end(), buffer_);
+  vector(const vector &v)
+      : allocator_holder(
+            alloc_traits::select_on_container_copy_construction(v.Alloc())) {
+    Initialize(v.capacity_, [&] {
+      for (const auto &item : v) {
+        Construct(buffer_ + size_, item);
+        ++size_;
+      }
+    });
   }
 
-  vector(vector &&v) noexcept {
+  vector(vector &&v) noexcept : allocator_holder(std::move(v.Alloc())) {
     size_ = std::exchange(v.size_, 0);
     capacity_ = std::exchange(v.capacity_, 0);
     buffer_ = std::exchange(v.buffer_, nullptr);
   }
 
-  ~vector() { delete[] buffer_; }
+  ~vector() { RemoveVector(); }
 
   constexpr vector &operator=(vector &&rhs) noexcept {
     if (this != &rhs) {
+      RemoveVector();
+      Alloc() = std::move(rhs.Alloc());
       size_ = std::exchange(rhs.size_, 0);
       capacity_ = std::exchange(rhs.capacity_, 0);
       buffer_ = std::exchange(rhs.buffer_, nullptr);
@@ -72,72 +112,86 @@ class vector {
 
   constexpr vector &operator=(const vector &rhs) {
     if (this != &rhs) {
-      delete[] buffer_;
-
-      if (rhs.size_ > 0) {
-        buffer_ = new value_type[rhs.capacity_];
-        std::copy(rhs.begin(), rhs.end(), buffer_);
+      if (rhs.size_ > capacity_) {
+        vector copy(rhs);
+        swap(copy);
+      } else {
+        size_type common = std::min(size_, rhs.size_);
+        std::copy(rhs.begin(), rhs.begin() + common, buffer_);
+        for (; size_ < rhs.size_; ++size_)
+          Construct(buffer_ + size_, rhs.buffer_[size_]);
+        DestroyTail(rhs.size_);
       }
-      size_ = rhs.size_;
-      capacity_ = rhs.capacity_;
     }
 
     return *this;
   }
+
+  allocator_type get_allocator() const noexcept { return Alloc(); }
+
   // Element Access
  public:
-  constexpr reference at(size_type pos) {
-    if (pos >= size_)
-      throw std::out_of_range("s21::vector::at The index is out of range");
+  constexpr checked_reference at(size_type pos) {
+    if (!CheckPolicy::Check(pos < size_))
+      return CheckPolicy::template Fail<reference>(
+          access_error::out_of_range,
+          "s21::vector::at The index is out of range");
 
-    return buffer_[pos];
+    return CheckPolicy::template Ok<reference>(buffer_[pos]);
   }
 
-  constexpr const_reference at(size_type pos) const {
-    if (pos >= size_)
-      throw std::out_of_range("s21::vector::at The index is out of range");
+  constexpr checked_const_reference at(size_type pos) const {
+    if (!CheckPolicy::Check(pos < size_))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::out_of_range,
+          "s21::vector::at The index is out of range");
 
-    return buffer_[pos];
+    return CheckPolicy::template Ok<const_reference>(buffer_[pos]);
   }
 
-  constexpr reference operator[](size_type pos) { return at(pos); }
+  // Never checked, use at() for checked access.
+  constexpr reference operator[](size_type pos) noexcept {
+    return buffer_[pos];
+  }
 
-  constexpr const_reference operator[](size_type pos) const { return at(pos); }
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    return buffer_[pos];
+  }
 
-  constexpr reference front() {
-    if (size_ == 0)
-      throw std::out_of_range(
-          "s21::vector::front Using methods on a "
-          "zero sized container results "
+  constexpr checked_reference front() {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<reference>(
+          access_error::empty,
+          "s21::vector::front Using methods on a zero sized container results "
           "in the UB");
-    return *begin();
+    return CheckPolicy::template Ok<reference>(*begin());
   }
 
-  constexpr const_reference front() const {
-    if (size_ == 0)
-      throw std::out_of_range(
-          "s21::vector::front Using methods on a "
-          "zero sized container results "
+  constexpr checked_const_reference front() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty,
+          "s21::vector::front Using methods on a zero sized container results "
           "in the UB");
-    return *begin();
+    return CheckPolicy::template Ok<const_reference>(*begin());
   }
 
-  constexpr reference back() {
-    if (size_ == 0)
-      throw std::out_of_range(
-          "s21::vector::back Using methods on a zero "
-          "sized container results "
+  constexpr checked_reference back() {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<reference>(
+          access_error::empty,
+          "s21::vector::back Using methods on a zero sized container results "
           "in the UB");
-    return *std::prev(end());
+    return CheckPolicy::template Ok<reference>(*std::prev(end()));
   }
 
-  constexpr const_reference back() const {
-    if (size_ == 0)
-      throw std::out_of_range(
-          "s21::vector::back Using methods on a zero "
-          "sized container results "
+  constexpr checked_const_reference back() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty,
+          "s21::vector::back Using methods on a zero sized container results "
           "in the UB");
-    return *std::prev(end());
+    return CheckPolicy::template Ok<const_reference>(*std::prev(end()));
   }
 
   constexpr iterator data() noexcept { return buffer_; }
@@ -153,14 +207,58 @@ class vector {
 
   constexpr const_iterator end() const noexcept { return buffer_ + size_; }
 
-  // Capacity
+  // Lookup
+  // Arithmetic elements are scanned with SIMD where the CPU supports it.
  public:
-  bool empty() const noexcept { return begin() == end(); }
+  iterator find(const_reference value) noexcept {
+    return begin() + detail::simd::Find(buffer_, size_, value);
+  }
+
+  const_iterator find(const_reference value) const noexcept {
+    return begin() + detail::simd::Find(buffer_, size_, value);
+  }
+
+  size_type count(const_reference value) const noexcept {
+    return detail::simd::Count(buffer_, size_, value);
+  }
+
+  bool contains(const_reference value) const noexcept {
+    return find(value) != end();
+  }
 
-  constexpr size_type size() const noexcept {
-    return std::distance(begin(), end());
+  // The first smallest and largest elements. NaNs are skipped unless the
+  // vector starts with one.
+  checked_const_reference min() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty,
+          "s21::vector::min Using methods on a zero sized container results "
+          "in the UB");
+    return CheckPolicy::template Ok<const_reference>(
+        buffer_[detail::simd::MinIndex(buffer_, size_)]);
+  }
+
+  checked_const_reference max() const {
+    if (!CheckPolicy::Check(size_ != 0))
+      return CheckPolicy::template Fail<const_reference>(
+          access_error::empty,
+          "s21::vector::max Using methods on a zero sized container results "
+          "in the UB");
+    return CheckPolicy::template Ok<const_reference>(
+        buffer_[detail::simd::MaxIndex(buffer_, size_)]);
+  }
+
+  // Accumulates in 64 bits (double for floating point elements).
+  detail::simd::SumType<value_type> sum() const noexcept {
+    return detail::simd::Sum(buffer_, size_);
   }
 
+  // Capacity
+ public:
+  bool empty() const noexcept { return size_ == 0; }
+
+  constexpr size_type size() const noexcept { return size_; }
+
   constexpr size_type max_size() const noexcept {
     return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
   }
@@ -179,12 +277,32 @@ class vector {
   constexpr size_type capacity() const noexcept { return capacity_; }
 
   constexpr void shrink_to_fit() {
-    if (capacity_ == size_) return;
+    size_type fit = GrowthPolicy::Fit(size_, sizeof(value_type));
+    if (fit >= capacity_) return;
 
-    ReallocVector(size_);
+    ReallocVector(fit);
   }
 
-  constexpr void clear() noexcept { size_ = 0; }
+  constexpr void clear() noexcept { DestroyTail(0); }
+
+  constexpr void resize(size_type count) {
+    ResizeWith(count, [this](iterator slot) { Construct(slot); });
+  }
+
+  constexpr void resize(size_type count, const_reference value) {
+    value_type copy(value);
+    ResizeWith(count, [this, &copy](iterator slot) { Construct(slot, copy); });
+  }
+
+  // Like resize(count), but new elements are default-initialized: for
+  // trivial types they are left unset, ready to be overwritten through
+  // data() (e.g. by read()) without a redundant zeroing pass.
+  constexpr void resize_for_overwrite(size_type count) {
+    if constexpr (std::is_trivially_default_constructible_v<value_type>)
+      ResizeWith(count, [](iterator) {});
+    else
+      resize(count);
+  }
 
   constexpr iterator insert(const_iterator pos, value_type &&value) {
     size_type index = pos - begin();
@@ -193,13 +311,7 @@ class vector {
           "s21::vector::insert Unable to insert into a position out of "
           "range of begin() to end()");
 
-    if (size_ == capacity_) ReallocVector(size_ ? size_ * 2 : 1);
-
-    std::copy(begin() + index, end(), begin() + index + 1);
-    *(buffer_ + index) = std::move(value);
-
-    ++size_;
-    return begin() + index;
+    return EmplaceAt(index, std::move(value));
   }
 
   constexpr iterator insert(const_iterator pos, const_reference value) {
@@ -209,13 +321,79 @@ class vector {
           "s21::vector::insert Unable to insert into a position out of "
           "range of begin() to end()");
 
-    if (size_ == capacity_) ReallocVector(size_ ? size_ * 2 : 1);
+    return EmplaceAt(index, value);
+  }
 
-    std::copy(begin() + index, end(), begin() + index + 1);
-    *(buffer_ + index) = value;
+  // The bulk inserts below reallocate at most once and shift the tail of the
+  // vector only once, whatever the number of inserted elements.
+  constexpr iterator insert(const_iterator pos, size_type count,
+                            const_reference value) {
+    size_type index = InsertIndex(pos);
+    value_type copy(value);
+    return InsertN(index, count, [this, &copy](iterator slot, bool live) {
+      Put(slot, live, copy);
+    });
+  }
 
-    ++size_;
-    return begin() + index;
+  template <typename InputIt, typename Category = typename std::iterator_traits<
+                                 InputIt>::iterator_category>
+  constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = InsertIndex(pos);
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      return InsertN(index, std::distance(first, last),
+                     [this, &first](iterator slot, bool live) {
+                       Put(slot, live, *first);
+                       ++first;
+                     });
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) EmplaceAt(size_, *first);
+      std::rotate(begin() + index, begin() + old_size, end());
+      return begin() + index;
+    }
+  }
+
+  constexpr iterator insert(const_iterator pos,
+                            std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename Range>
+  constexpr void append_range(const Range &range) {
+    insert(end(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  constexpr iterator insert_many(const_iterator pos, Args &&...args) {
+    size_type index = InsertIndex(pos);
+    if constexpr (sizeof...(Args) == 0) {
+      return begin() + index;
+    } else {
+      // args may refer to elements of this vector, so they are turned into
+      // values before anything is shifted.
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      value_type *item = items;
+      return InsertN(index, sizeof...(Args),
+                     [this, &item](iterator slot, bool live) {
+                       Put(slot, live, std::move(*item++));
+                     });
+    }
+  }
+
+  template <typename... Args>
+  constexpr void insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = pos - begin();
+    if (index > size_)
+      throw std::out_of_range(
+          "s21::vector::emplace Unable to insert into a position out of "
+          "range of begin() to end()");
+
+    return EmplaceAt(index, std::forward<Args>(args)...);
   }
 
   constexpr iterator erase(const_iterator pos) {
@@ -225,25 +403,59 @@ class vector {
           "s21::vector::erase Unable to erase a position out of range of "
           "begin() to end()");
 
-    std::copy(begin(), const_cast<iterator>(pos), buffer_);
-    std::copy(const_cast<iterator>(pos) + 1, end(), buffer_ + index);
+    detail::ShiftElements(buffer_ + index + 1, end(), buffer_ + index);
 
-    --size_;
+    DestroyTail(size_ - 1);
     return begin() + index;
   }
 
-  constexpr void push_back(const_reference value) {
-    if (size_ == capacity_) reserve(size_ ? size_ * 2 : 1);
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type index = first - begin();
+    size_type count = last - first;
+    if (first > last || index + count > size_)
+      throw std::out_of_range(
+          "s21::vector::erase Unable to erase a range out of range of "
+          "begin() to end()");
 
-    buffer_[size_] = value;
-    ++size_;
+    if (count) {
+      detail::ShiftElements(buffer_ + index + count, end(), buffer_ + index);
+      DestroyTail(size_ - count);
+    }
+    return begin() + index;
   }
 
+  // Removes every element matching pred in a single pass: each run of
+  // survivors is shifted down at once (a memmove for trivial types) and the
+  // vacated tail is destroyed. Like std::remove_if, pred sees each element
+  // exactly once, always the same pred object. Returns the number of
+  // removed elements.
+  template <typename Predicate>
+  constexpr size_type remove_if(Predicate pred) {
+    auto matches = [&pred](reference item) -> bool { return pred(item); };
+    iterator write = std::find_if(begin(), end(), matches);
+    iterator read = write;
+    // read is end() or an element known to match.
+    while (read != end()) {
+      iterator run = std::find_if_not(read + 1, end(), matches);
+      read = run == end() ? run : std::find_if(run + 1, end(), matches);
+      detail::ShiftElements(run, read, write);
+      write += read - run;
+    }
+
+    size_type removed = end() - write;
+    DestroyTail(write - begin());
+    return removed;
+  }
+
+  constexpr void push_back(const_reference value) { EmplaceAt(size_, value); }
+
   constexpr void push_back(value_type &&value) {
-    if (size_ == capacity_) reserve(size_ ? size_ * 2 : 1);
+    EmplaceAt(size_, std::move(value));
+  }
 
-    buffer_[size_] = std::move(value);
-    ++size_;
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    return *EmplaceAt(size_, std::forward<Args>(args)...);
   }
 
   constexpr void pop_back() {
@@ -251,30 +463,273 @@ class vector {
       throw std::length_error(
           "s21::vector::pop_back Calling pop_back on an empty container "
           "results in UB");
-    --size_;
+    DestroyTail(size_ - 1);
   }
 
   constexpr void swap(vector &other) noexcept {
+    std::swap(Alloc(), other.Alloc());
     std::swap(buffer_, other.buffer_);
     std::swap(size_, other.size_);
     std::swap(capacity_, other.capacity_);
   }
 
  private:
+  using allocator_holder::Alloc;
+
   size_type size_ = 0;
   size_type capacity_ = 0;
   iterator buffer_ = nullptr;
 
+  // Only [0, size_) of the buffer holds constructed objects, the rest of it
+  // is raw memory obtained from the allocator.
+  iterator AllocateBuffer(size_type count) {
+    return count ? alloc_traits::allocate(Alloc(), count) : nullptr;
+  }
+
+  void DeallocateBuffer(iterator buffer, size_type count) noexcept {
+    if (buffer) alloc_traits::deallocate(Alloc(), buffer, count);
+  }
+
+  template <typename... Args>
+  void Construct(iterator where, Args &&...args) {
+    alloc_traits::construct(Alloc(), where, std::forward<Args>(args)...);
+  }
+
+  void DestroyTail(size_type new_size) noexcept {
+    detail::Destroy(Alloc(), buffer_ + new_size, buffer_ + size_);
+    size_ = new_size;
+  }
+
+  // Runs build, which constructs the first elements of a fresh buffer of
+  // capacity elements. The destructor doesn't run when a constructor throws,
+  // so whatever build managed to construct is torn down here.
+  template <typename Build>
+  void Initialize(size_type capacity, Build build) {
+    buffer_ = AllocateBuffer(capacity);
+    capacity_ = capacity;
+    try {
+      build();
+    } catch (...) {
+      RemoveVector();
+      throw;
+    }
+  }
+
+  void RemoveVector() noexcept {
+    DestroyTail(0);
+    DeallocateBuffer(buffer_, capacity_);
+    buffer_ = nullptr;
+    capacity_ = 0;
+  }
+
+  size_type GrowCapacity(size_type required) const {
+    size_type new_capacity =
+        GrowthPolicy::Grow(capacity_, required, sizeof(value_type));
+    if (new_capacity > max_size())
+      throw std::length_error(
+          "s21::vector Capacity can't be larger than Vector<T>::max_size()");
+    return new_capacity;
+  }
+
   void ReallocVector(size_type new_capacity) {
-    iterator tmp = new value_type[new_capacity];
-    for (size_type i = 0; i < size_; ++i) tmp[i] = std::move(buffer_[i]);
+    if constexpr (kReallocInPlace) {
+      if (buffer_ && new_capacity) {
+        buffer_ = Alloc().reallocate(buffer_, capacity_, new_capacity);
+        capacity_ = new_capacity;
+        return;
+      }
+    }
+
+    iterator tmp = AllocateBuffer(new_capacity);
+    try {
+      detail::Relocate(Alloc(), begin(), end(), tmp);
+    } catch (...) {
+      DeallocateBuffer(tmp, new_capacity);
+      throw;
+    }
 
-    delete[] buffer_;
+    DeallocateBuffer(buffer_, capacity_);
     buffer_ = tmp;
     capacity_ = new_capacity;
   }
+
+  template <typename Make>
+  void ResizeWith(size_type count, Make make) {
+    if (count <= size_) {
+      DestroyTail(count);
+      return;
+    }
+
+    if (count > capacity_) ReallocVector(GrowCapacity(count));
+    for (; size_ < count; ++size_) make(buffer_ + size_);
+  }
+
+  size_type InsertIndex(const_iterator pos) const {
+    size_type index = pos - begin();
+    if (index > size_)
+      throw std::out_of_range(
+          "s21::vector::insert Unable to insert into a position out of "
+          "range of begin() to end()");
+    return index;
+  }
+
+  // Writes value into a slot of the buffer that is either a live element or
+  // raw memory.
+  template <typename Value>
+  void Put(iterator slot, bool live, Value &&value) {
+    if (live)
+      *slot = std::forward<Value>(value);
+    else
+      Construct(slot, std::forward<Value>(value));
+  }
+
+  // Inserts count elements at index. The tail is moved once, into a new
+  // buffer if it has to grow, then put(slot, live) writes each new element in
+  // order. The source of put must not alias the vector.
+  template <typename PutNext>
+  iterator InsertN(size_type index, size_type count, PutNext put) {
+    if (count == 0) return begin() + index;
+
+    size_type new_size = size_ + count;
+    if (new_size > capacity_ && !kReallocInPlace) {
+      size_type new_capacity = GrowCapacity(new_size);
+      iterator tmp = AllocateBuffer(new_capacity);
+      bool prefix_moved = false;
+      try {
+        detail::UninitializedMove(Alloc(), begin(), begin() + index, tmp);
+        prefix_moved = true;
+        detail::UninitializedMove(Alloc(), begin() + index, end(),
+                                  tmp + index + count);
+      } catch (...) {
+        if (prefix_moved) detail::Destroy(Alloc(), tmp, tmp + index);
+        DeallocateBuffer(tmp, new_capacity);
+        throw;
+      }
+      detail::Destroy(Alloc(), begin(), end());
+      DeallocateBuffer(buffer_, capacity_);
+      buffer_ = tmp;
+      capacity_ = new_capacity;
+      return FillGap(index, count, index, new_size, put);
+    }
+
+    if (new_size > capacity_) ReallocVector(GrowCapacity(new_size));
+
+    if constexpr (detail::kIsTriviallyRelocatable<value_type>) {
+      detail::ShiftElements(begin() + index, end(), begin() + index + count);
+      return FillGap(index, count, index, new_size, put);
+    } else {
+      // Elements moved past the old end go to raw memory, the rest is shifted
+      // over live ones. The gap keeps moved-from objects up to live_end.
+      size_type split = std::max(index, size_ - std::min(size_, count));
+      detail::UninitializedMove(Alloc(), begin() + split, end(),
+                                begin() + split + count);
+      detail::ShiftElements(begin() + index, begin() + split,
+                            begin() + index + count);
+      return FillGap(index, count, std::min(size_, index + count), new_size,
+                     put);
+    }
+  }
+
+  // Fills the gap [index, index + count) of a buffer holding new_size
+  // elements. On exception everything from index on is dropped.
+  template <typename PutNext>
+  iterator FillGap(size_type index, size_type count, size_type live_end,
+                   size_type new_size, PutNext &put) {
+    size_type pos = index;
+    try {
+      for (; pos < index + count; ++pos) put(buffer_ + pos, pos < live_end);
+    } catch (...) {
+      detail::Destroy(Alloc(), buffer_ + index,
+                      buffer_ + std::max(pos, live_end));
+      detail::Destroy(Alloc(), buffer_ + index + count, buffer_ + new_size);
+      size_ = index;
+      throw;
+    }
+    size_ = new_size;
+    return begin() + index;
+  }
+
+  template <typename... Args>
+  iterator EmplaceAt(size_type index, Args &&...args) {
+    if constexpr (kReallocInPlace) {
+      if (size_ == capacity_) {
+        value_type value(std::forward<Args>(args)...);
+        ReallocVector(GrowCapacity(size_ + 1));
+        return EmplaceAt(index, std::move(value));
+      }
+    }
+
+    if (size_ == capacity_) {
+      // The new element is built before the old buffer is touched, so args
+      // may safely refer to elements of this vector.
+      size_type new_capacity = GrowCapacity(size_ + 1);
+      iterator tmp = AllocateBuffer(new_capacity);
+      int stage = 0;
+      try {
+        Construct(tmp + index, std::forward<Args>(args)...);
+        stage = 1;
+        detail::UninitializedMove(Alloc(), begin(), begin() + index, tmp);
+        stage = 2;
+        detail::UninitializedMove(Alloc(), begin() + index, end(),
+                                  tmp + index + 1);
+      } catch (...) {
+        if (stage == 2) detail::Destroy(Alloc(), tmp, tmp + index);
+        if (stage >= 1)
+          detail::Destroy(Alloc(), tmp + index, tmp + index + 1);
+        DeallocateBuffer(tmp, new_capacity);
+        throw;
+      }
+      detail::Destroy(Alloc(), begin(), end());
+
+      DeallocateBuffer(buffer_, capacity_);
+      buffer_ = tmp;
+      capacity_ = new_capacity;
+    } else if (index == size_) {
+      Construct(end(), std::forward<Args>(args)...);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      if constexpr (detail::kIsTriviallyRelocatable<value_type>) {
+        detail::ShiftElements(begin() + index, end(), begin() + index + 1);
+      } else {
+        Construct(end(), std::move(*(end() - 1)));
+        detail::ShiftElements(begin() + index, end() - 1, begin() + index + 1);
+      }
+      buffer_[index] = std::move(value);
+    }
+
+    ++size_;
+    return begin() + index;
+  }
 };
 
+template <typename T, typename Allocator, typename GrowthPolicy,
+          typename CheckPolicy, typename Predicate>
+std::size_t erase_if(vector<T, Allocator, GrowthPolicy, CheckPolicy> &v,
+                     Predicate pred) {
+  return v.remove_if(pred);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy,
+          typename CheckPolicy, typename U>
+std::size_t erase(vector<T, Allocator, GrowthPolicy, CheckPolicy> &v,
+                  const U &value) {
+  return v.remove_if([&value](const T &item) { return item == value; });
+}
+
+// Vector for multi-gigabyte buffers of trivially copyable elements: once the
+// buffer is large it lives in an anonymous mapping that grows with mremap,
+// so growing never copies the elements.
+template <typename T>
+using large_vector = vector<T, remap_allocator<T>, growth::large_buffer<>>;
+
+// Vector whose data() always starts on an Align-byte boundary, so SIMD code
+// can use aligned loads. Use cache_padded<T> elements to also keep every
+// element on a cache line of its own.
+template <typename T, std::size_t Align = kCacheLineBytes>
+using aligned_vector = vector<T, aligned_allocator<T, Align>>;
+
 }  // namespace s21
 
+#include "vector/bit_vector.h"
+
 #endif  // CPP2_S21_CONTAINERS_S21_VECTOR_H_
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "../s21_array.h"
 
 TEST(ArrayTest, DefaultConstructor) {
@@ -11,8 +15,7 @@ TEST(ArrayTest, DefaultConstructor) {
 }
 
 TEST(ArrayTest, ParameterizedConstructor) {
-  std::initializer_list<int> items = {1, 2, 3, 4, 5};
-  s21::array<int, 10> arr(items);
+  s21::array<int, 10> arr{1, 2, 3, 4, 5};
   EXPECT_EQ(10, arr.max_size());
   EXPECT_EQ(1, arr[0]);
   EXPECT_EQ(2, arr[1]);
@@ -130,8 +133,7 @@ TEST(ArrayTest, ConstDefaultConstructor) {
 }
 
 TEST(ArrayTest, ConstParameterizedConstructor) {
-  std::initializer_list<int> items = {1, 2, 3, 4, 5};
-  const s21::array<int, 10> arr(items);
+  const s21::array<int, 10> arr{1, 2, 3, 4, 5};
   EXPECT_EQ(10, arr.max_size());
   EXPECT_EQ(1, arr[0]);
   EXPECT_EQ(2, arr[1]);
@@ -194,4 +196,165 @@ TEST(ArrayTest, ConstBeginEndTest) {
   const s21::array<int, 5> arr1{0, 1, 2, 3, 4};
   EXPECT_EQ(arr1.cbegin(), &arr1[0]);
   EXPECT_EQ(arr1.cend(), &arr1[5]);
-}
\ No newline at end of file
+}
+
+TEST(ArrayTest, CheckPolicies) {
+  s21::array<int, 3> checked{1, 2, 3};
+  EXPECT_THROW(checked.at(3), std::out_of_range);
+  checked.front() = 0;
+  EXPECT_EQ(checked[0], 0);
+
+  s21::array<int, 3, s21::check::unchecked> fast{1, 2, 3};
+  EXPECT_EQ(fast.at(2), 3);
+  EXPECT_EQ(fast.back(), 3);
+
+  s21::array<int, 2, s21::check::expected> soft{4, 5};
+  EXPECT_EQ(*soft.back(), 5);
+  EXPECT_EQ(soft.at(2).error(), s21::access_error::out_of_range);
+  s21::array<int, 0, s21::check::expected> empty;
+  EXPECT_EQ(empty.front().error(), s21::access_error::empty);
+  EXPECT_THROW((s21::array<int, 0>().back()), std::out_of_range);
+}
+
+TEST(ArrayTest, SimdScans) {
+  s21::array<int, 19> ints{4, 9, 1, 9, 7, 1, 2, 3, 8, 6, 5, 0, 4, 9, -3, 2};
+  EXPECT_EQ(ints.find(9) - ints.begin(), 1);
+  EXPECT_EQ(ints.find(42), ints.end());
+  EXPECT_EQ(ints.count(9), 3);
+  EXPECT_EQ(ints.count(0), 4);
+  EXPECT_TRUE(ints.contains(-3));
+  EXPECT_EQ(&ints.min(), &ints[14]);
+  EXPECT_EQ(&ints.max(), &ints[1]);
+  EXPECT_EQ(ints.sum(), 67);
+
+  const s21::array<double, 5> reals{0.5, -2.5, 8.0, 1.0, 8.0};
+  EXPECT_EQ(*reals.find(8.0), 8.0);
+  EXPECT_EQ(reals.min(), -2.5);
+  EXPECT_EQ(&reals.max(), &reals[2]);
+  EXPECT_DOUBLE_EQ(reals.sum(), 15.0);
+
+  s21::array<int, 0, s21::check::expected> empty;
+  EXPECT_EQ(empty.min().error(), s21::access_error::empty);
+  EXPECT_EQ(empty.sum(), 0);
+}
+
+TEST(ArrayTest, AlignedArray) {
+  s21::aligned_array<float, 5> floats{1, 2, 3};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(floats.data()) % 64, 0);
+  EXPECT_EQ(alignof(decltype(floats)), 64);
+  EXPECT_EQ(floats[2], 3);
+
+  s21::array<double, 4, s21::check::throwing, 32> wide{};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide.data()) % 32, 0);
+
+  s21::array<s21::cache_padded<long>, 3> slots;
+  *slots[2] = 7;
+  EXPECT_EQ(*slots[2], 7);
+  EXPECT_EQ(sizeof(slots[0]), s21::kCacheLineBytes);
+}
+
+TEST(ArrayTest, TriviallyCopyableAggregate) {
+  static_assert(std::is_aggregate_v<s21::array<int, 3>>);
+  static_assert(std::is_trivially_copyable_v<s21::array<float, 4>>);
+  static_assert(std::is_standard_layout_v<s21::array<float, 4>>);
+  static_assert(sizeof(s21::array<float, 4>) == 4 * sizeof(float));
+  static_assert(sizeof(s21::array<s21::array<float, 4>, 3>) ==
+                12 * sizeof(float));
+  static_assert(s21::array<int, 7>().size() == 7);
+
+  s21::array<s21::array<float, 4>, 3> grid{};
+  grid[1][2] = 6;
+  const float *flat = grid[0].data();
+  EXPECT_EQ(flat[6], 6);
+
+  s21::array<s21::array<float, 4>, 3> copy;
+  std::memcpy(&copy, &grid, sizeof(grid));
+  EXPECT_EQ(copy[1][2], 6);
+  EXPECT_EQ(copy[2][3], 0);
+}
+
+namespace {
+
+constexpr s21::array<unsigned, 256> MakeCrcTable() {
+  s21::array<unsigned, 256> table{};
+  for (unsigned i = 0; i < table.size(); ++i) {
+    unsigned crc = i;
+    for (int bit = 0; bit < 8; ++bit)
+      crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr s21::array<int, 6> SortedSquares() {
+  s21::array<int, 6> items{3, -5, 0, 2, -1, 4};
+  s21::constexpr_algo::transform(items.begin(), items.end(), items.begin(),
+                                 [](int x) { return x * x; });
+  s21::constexpr_algo::sort(items.begin(), items.end());
+  return items;
+}
+
+constexpr s21::array<int, 4> FilledAndSwapped() {
+  s21::array<int, 4> a{};
+  s21::array<int, 4> b{1, 2, 3, 4};
+  a.fill(7);
+  s21::constexpr_algo::fill(a.begin() + 2, a.end(), 9);
+  a.swap(b);
+  return b;
+}
+
+}  // namespace
+
+TEST(ArrayTest, Constexpr) {
+  static constexpr auto kCrc = MakeCrcTable();
+  static_assert(kCrc[1] == 0x77073096u);
+  static_assert(kCrc.at(255) == 0x2D02EF8Du);
+  static_assert(kCrc.front() == 0 && kCrc.back() == kCrc[255]);
+  static_assert(*(kCrc.end() - 1) == kCrc[255]);
+
+  constexpr auto kSquares = SortedSquares();
+  static_assert(kSquares[0] == 0 && kSquares[1] == 1 && kSquares[2] == 4 &&
+                kSquares[3] == 9 && kSquares[4] == 16 && kSquares[5] == 25);
+
+  constexpr auto kSwapped = FilledAndSwapped();
+  static_assert(kSwapped[0] == 7 && kSwapped[1] == 7 && kSwapped[3] == 9);
+
+  constexpr s21::array<double, 3> kDescending = [] {
+    s21::array<double, 3> items{0.5, 2.5, 1.5};
+    s21::constexpr_algo::sort(items.begin(), items.end(), std::greater<>());
+    return items;
+  }();
+  static_assert(kDescending[0] == 2.5 && kDescending[2] == 0.5);
+
+  s21::array<std::string, 5> words{"pear", "fig", "apple", "kiwi", "date"};
+  s21::constexpr_algo::sort(words.begin(), words.end());
+  EXPECT_TRUE(std::is_sorted(words.begin(), words.end()));
+  EXPECT_THROW(kCrc.at(256), std::out_of_range);
+
+  s21::array<int, 64> items{};
+  for (int size = 0; size <= 64; ++size) {
+    for (int i = 0; i < size; ++i) items[i] = (i * 29 + size) % 17;
+    std::array<int, 64> expected;
+    std::copy(items.begin(), items.begin() + size, expected.begin());
+    std::sort(expected.begin(), expected.begin() + size);
+    s21::constexpr_algo::sort(items.begin(), items.begin() + size);
+    EXPECT_TRUE(std::equal(items.begin(), items.begin() + size,
+                           expected.begin()));
+  }
+}
+
+TEST(ArrayTest, UnqualifiedStdAlgorithms) {
+  // s21 is an associated namespace of these iterators, so unqualified calls
+  // must not find a second candidate there.
+  std::vector<s21::array<int, 2>> pairs{{3, 1}, {1, 2}, {2, 0}};
+  sort(pairs.begin(), pairs.end(),
+       [](const auto &a, const auto &b) { return a[0] < b[0]; });
+  EXPECT_EQ(pairs[0][1], 2);
+  fill(pairs.begin(), pairs.end(), s21::array<int, 2>{4, 4});
+  transform(pairs.begin(), pairs.end(), pairs.begin(), [](auto pair) {
+    pair[1] = 0;
+    return pair;
+  });
+  EXPECT_EQ(pairs[2][0], 4);
+  EXPECT_EQ(pairs[2][1], 0);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_concurrent_vector.h"
+
+TEST(ConcurrentVectorTest, SingleThread) {
+  s21::concurrent_vector<std::string> v;
+  EXPECT_TRUE(v.empty());
+  auto it = v.push_back("zero");
+  EXPECT_EQ(*it, "zero");
+  std::string &first = v[0];
+  for (int i = 1; i < 1000; ++i) v.emplace_back(std::to_string(i));
+  // Growing never moves elements.
+  EXPECT_EQ(&first, &v[0]);
+  EXPECT_EQ(v.size(), 1000);
+  EXPECT_EQ(v.at(999), "999");
+  EXPECT_THROW(v.at(1000), std::out_of_range);
+
+  auto run = v.grow_by(3, "x");
+  EXPECT_EQ(run - v.begin(), 1000);
+  EXPECT_EQ(v[1002], "x");
+  v.grow_by(2);
+  EXPECT_EQ(v.size(), 1005);
+  EXPECT_TRUE(v[1004].empty());
+
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  v.reserve(100);
+  v.push_back("again");
+  EXPECT_EQ(v[0], "again");
+}
+
+struct ThrowingCopy {
+  static int alive;
+  explicit ThrowingCopy(int value) : value(value) { ++alive; }
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (value < 0) throw std::runtime_error("negative");
+    ++alive;
+  }
+  ~ThrowingCopy() { --alive; }
+  int value;
+};
+int ThrowingCopy::alive = 0;
+
+TEST(ConcurrentVectorTest, FailedConstructionBreaksSlots) {
+  {
+    s21::concurrent_vector<ThrowingCopy> v;
+    v.push_back(ThrowingCopy(1));
+    EXPECT_THROW(v.push_back(ThrowingCopy(-1)), std::runtime_error);
+    v.push_back(ThrowingCopy(3));
+    ASSERT_EQ(v.size(), 3);
+    EXPECT_FALSE(v.is_broken(0));
+    EXPECT_TRUE(v.is_broken(1));
+    EXPECT_EQ(v[2].value, 3);
+
+    // A run that fails midway is broken as a whole.
+    ThrowingCopy good(4);
+    ThrowingCopy bad(-4);
+    v.grow_by(2, good);
+    EXPECT_THROW(v.grow_by(20, bad), std::runtime_error);
+    ASSERT_EQ(v.size(), 25);
+    for (int pos = 5; pos < 25; ++pos) EXPECT_TRUE(v.is_broken(pos));
+    EXPECT_EQ(ThrowingCopy::alive, 6);
+
+    v.clear();
+    EXPECT_EQ(ThrowingCopy::alive, 2);
+    v.push_back(good);
+    EXPECT_FALSE(v.is_broken(0));
+    EXPECT_FALSE(v.is_broken(1));
+  }
+  EXPECT_EQ(ThrowingCopy::alive, 0);
+}
+
+TEST(ConcurrentVectorTest, ParallelPushBack) {
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 100000;
+  s21::concurrent_vector<int> v;
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreads; ++t)
+    producers.emplace_back([&v, t] {
+      for (int i = 0; i < kPerThread; ++i) v.push_back(t * kPerThread + i);
+    });
+  for (std::thread &producer : producers) producer.join();
+
+  // Every value made it in exactly once.
+  ASSERT_EQ(v.size(), kThreads * kPerThread);
+  std::vector<bool> seen(kThreads * kPerThread);
+  for (int value : v) {
+    ASSERT_FALSE(seen[value]);
+    seen[value] = true;
+  }
+
+  // Each producer's values keep their relative order.
+  std::vector<int> last(kThreads, -1);
+  for (int value : v) {
+    int thread = value / kPerThread;
+    EXPECT_GT(value, last[thread]);
+    last[thread] = value;
+  }
+}
+
+TEST(ConcurrentVectorTest, ReferencesStayValidWhileGrowing) {
+  s21::concurrent_vector<long> v;
+  long &anchor = v.emplace_back(42);
+  std::vector<std::thread> producers;
+  for (int t = 0; t < 4; ++t)
+    producers.emplace_back([&v] {
+      for (int i = 0; i < 20000; ++i) {
+        auto run = v.grow_by(4, i);
+        EXPECT_EQ(run[3], i);
+      }
+    });
+  for (std::thread &producer : producers) producer.join();
+  EXPECT_EQ(anchor, 42);
+  EXPECT_EQ(&anchor, &v[0]);
+  EXPECT_EQ(v.size(), 1 + 4 * 20000 * 4);
+}
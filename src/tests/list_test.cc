@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <list>
+#include <memory>
+#include <random>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "../s21_list.h"
 
@@ -214,6 +219,19 @@ TEST(ListTest, MoveAssignmentOperatorEmpty) {
   EXPECT_TRUE(compare_lists(my_list, std_list));
 }
 
+TEST(ListTest, MovesDontThrow) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::list<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::list<int>>);
+  static_assert(std::is_nothrow_swappable_v<s21::list<int>>);
+
+  // So std::vector moves the lists when it grows instead of copying them.
+  std::vector<s21::list<int>> lists(1);
+  lists[0].push_back(1);
+  const int *first = &lists[0].front();
+  lists.resize(lists.capacity() + 1);
+  EXPECT_EQ(&lists[0].front(), first);
+}
+
 TEST(ListAccess, Front1) {
   s21::list<int> my_list{99, 2, 3, 4, 5};
   std::list<int> std_list{99, 2, 3, 4, 5};
@@ -542,8 +560,7 @@ TEST(ListIterators, Begin2) {
 
 TEST(ListIterators, Begin3) {
   s21::list<int> my_list;
-  std::list<int> std_list;
-  EXPECT_EQ(*my_list.begin(), *std_list.begin());
+  EXPECT_TRUE(my_list.begin() == my_list.end());
 }
 
 TEST(ListIterators, End1) {
@@ -553,15 +570,16 @@ TEST(ListIterators, End1) {
 }
 
 TEST(ListIterators, End2) {
-  s21::list<int> my_list(4);
-  std::list<int> std_list(4);
-  EXPECT_EQ(*my_list.end(), *std_list.end());
+  s21::list<int> my_list{1, 2, 3, 4};
+  std::list<int> std_list{1, 2, 3, 4};
+  EXPECT_EQ(*--my_list.end(), *--std_list.end());
+  EXPECT_TRUE(++--my_list.end() == my_list.end());
 }
 
 TEST(ListIterators, End3) {
   s21::list<int> my_list;
-  std::list<int> std_list;
-  EXPECT_EQ(*my_list.end(), *std_list.end());
+  EXPECT_TRUE(--my_list.end() == my_list.end());
+  EXPECT_TRUE(++my_list.end() == my_list.begin());
 }
 
 TEST(ListModifiers, Merge1) {
@@ -749,6 +767,58 @@ TEST(ListModifiers, Splice4) {
   EXPECT_TRUE(compare_lists(my_list1, std_list1));
 }
 
+TEST(ListModifiers, SpliceMovesNodes) {
+  s21::list<int> my_list1{1, 2, 3};
+  s21::list<int> my_list2{10, 20, 30, 40};
+  const int *twenty = &*++my_list2.begin();
+
+  // A single element, within the same list and from another one.
+  my_list1.splice(my_list1.begin(), my_list1, --my_list1.end());
+  my_list1.splice(my_list1.end(), my_list2, ++my_list2.begin());
+  EXPECT_EQ(&my_list1.back(), twenty);
+
+  // A range, then the rest.
+  auto first = my_list2.begin();
+  auto last = ++++my_list2.begin();
+  my_list1.splice(++my_list1.begin(), my_list2, first, last);
+  EXPECT_EQ(my_list2.size(), 1);
+  my_list1.splice(my_list1.begin(), my_list2);
+  EXPECT_TRUE(my_list2.empty());
+  my_list2.push_back(5);
+
+  std::list<int> std_list1{40, 3, 10, 30, 1, 2, 20};
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_EQ(my_list2.front(), 5);
+  EXPECT_EQ(*--my_list1.end(), 20);
+
+  // Moving a range to the end of its own list.
+  my_list1.splice(my_list1.end(), my_list1, my_list1.begin(),
+                  ++++my_list1.begin());
+  std::list<int> std_list2{10, 30, 1, 2, 20, 40, 3};
+  EXPECT_TRUE(compare_lists(my_list1, std_list2));
+}
+
+TEST(ListModifiers, MergeRelinksAndEmptiesOther) {
+  s21::list<std::pair<int, char>> my_list1{{1, 'a'}, {3, 'a'}, {3, 'b'}};
+  s21::list<std::pair<int, char>> my_list2{{0, 'c'}, {3, 'c'}, {4, 'c'}};
+  const std::pair<int, char> *moved = &my_list2.back();
+  auto by_key = [](const auto &lhs, const auto &rhs) {
+    return lhs.first < rhs.first;
+  };
+  my_list1.merge(my_list2, by_key);
+
+  std::list<std::pair<int, char>> std_list{
+      {0, 'c'}, {1, 'a'}, {3, 'a'}, {3, 'b'}, {3, 'c'}, {4, 'c'}};
+  EXPECT_TRUE(compare_lists(my_list1, std_list));
+  EXPECT_TRUE(my_list2.empty());
+  EXPECT_EQ(&my_list1.back(), moved);
+
+  my_list2.push_back({-1, 'd'});
+  my_list1.merge(my_list2, by_key);
+  EXPECT_EQ(my_list1.front().second, 'd');
+  EXPECT_EQ(my_list1.size(), 7);
+}
+
 TEST(ListModifiers, Insert1) {
   s21::list<int> my_list{1, 9999, 20000};
   my_list.insert(my_list.begin(), 5);
@@ -955,6 +1025,280 @@ TEST(ListHard, Hard) {
   EXPECT_TRUE(compare_lists(my_list, std_list));
 }
 
+TEST(ListModifiers, EmplaceMoveOnly) {
+  s21::list<std::unique_ptr<std::string>> my_list;
+  my_list.emplace_back(new std::string("b"));
+  my_list.push_back(std::make_unique<std::string>("c"));
+  my_list.emplace_front(new std::string("a"));
+  my_list.push_front(std::make_unique<std::string>("0"));
+  auto it = my_list.emplace(++my_list.begin(), new std::string("1"));
+  EXPECT_EQ(**it, "1");
+  my_list.insert(my_list.end(), std::make_unique<std::string>("d"));
+
+  std::list<std::string> std_list{"0", "1", "a", "b", "c", "d"};
+  ASSERT_EQ(my_list.size(), std_list.size());
+  auto std_it = std_list.begin();
+  for (auto my_it = my_list.begin(); my_it != my_list.end(); ++my_it)
+    EXPECT_EQ(**my_it, *std_it++);
+  my_list.pop_front();
+  EXPECT_EQ(*my_list.front(), "1");
+}
+
+TEST(ListModifiers, EmplaceReturnsElement) {
+  s21::list<std::pair<int, std::string>> my_list;
+  auto &pair = my_list.emplace_back(1, "one");
+  EXPECT_EQ(pair.first, 1);
+  my_list.emplace_front(0, "zero");
+  EXPECT_EQ(my_list.front().second, "zero");
+  EXPECT_EQ(my_list.back().second, "one");
+}
+
+TEST(ListElementAccess, CheckPolicies) {
+  s21::list<int> checked;
+  EXPECT_THROW(checked.front(), std::out_of_range);
+  EXPECT_THROW(checked.back(), std::out_of_range);
+  checked.push_back(1);
+  checked.back() = 2;
+  EXPECT_EQ(checked.front(), 2);
+
+  s21::list<int, std::allocator<int>, s21::check::expected> soft;
+  EXPECT_EQ(soft.front().error(), s21::access_error::empty);
+  soft.push_back(3);
+  EXPECT_EQ(soft.back().value(), 3);
+
+  s21::list<int, std::allocator<int>, s21::check::unchecked> fast{7, 8};
+  EXPECT_EQ(fast.front(), 7);
+  EXPECT_EQ(fast.back(), 8);
+}
+
+TEST(ListModifiers, SortIsStableWithComparator) {
+  s21::list<std::pair<int, char>> s21_list{{2, 'a'}, {1, 'b'}, {2, 'c'},
+                                           {0, 'd'}, {1, 'e'}, {2, 'f'}};
+  std::list<std::pair<int, char>> std_list{{2, 'a'}, {1, 'b'}, {2, 'c'},
+                                           {0, 'd'}, {1, 'e'}, {2, 'f'}};
+  auto by_key = [](const auto &lhs, const auto &rhs) {
+    return lhs.first > rhs.first;
+  };
+  s21_list.sort(by_key);
+  std_list.sort(by_key);
+  EXPECT_TRUE(compare_lists(s21_list, std_list));
+  EXPECT_EQ(s21_list.back().second, 'd');
+}
+
+TEST(ListModifiers, SortRelinksNodes) {
+  std::mt19937 random(21);
+  s21::list<int> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 100000; ++i) {
+    int value = random() % 1000;
+    s21_list.push_back(value);
+    std_list.push_back(value);
+  }
+  const int *first = &s21_list.front();
+  s21_list.sort();
+  std_list.sort();
+  EXPECT_TRUE(compare_lists(s21_list, std_list));
+
+  // The element that was first is still at the same address somewhere.
+  bool found = false;
+  for (auto it = s21_list.begin(); it != s21_list.end(); ++it)
+    found |= &*it == first;
+  EXPECT_TRUE(found);
+
+  // The links are intact in both directions.
+  s21_list.push_front(-1);
+  s21_list.push_back(1000);
+  std_list.push_front(-1);
+  std_list.push_back(1000);
+  auto it = s21_list.end();
+  for (auto std_it = std_list.rbegin(); std_it != std_list.rend(); ++std_it)
+    EXPECT_EQ(*--it, *std_it);
+  EXPECT_TRUE(it == s21_list.begin());
+}
+
+TEST(ListModifiers, SortRandomizedIsStable) {
+  std::mt19937 random(21);
+  for (int size : {0, 1, 2, 3, 7, 64, 65, 1000, 4099}) {
+    s21::list<std::pair<int, int>> s21_list;
+    std::vector<std::pair<int, int>> expected;
+    for (int i = 0; i < size; ++i) {
+      // Few distinct keys, so that equal keys are common.
+      std::pair<int, int> item(random() % 16, i);
+      s21_list.push_back(item);
+      expected.push_back(item);
+    }
+    auto by_key = [](const auto &lhs, const auto &rhs) {
+      return lhs.first < rhs.first;
+    };
+    s21_list.sort(by_key);
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+    ASSERT_EQ(s21_list.size(), expected.size());
+    auto it = s21_list.begin();
+    for (const auto &item : expected) EXPECT_EQ(*it++, item);
+  }
+}
+
+namespace {
+
+template <typename T>
+using pooled_list = s21::list<T, s21::pool_allocator<T>>;
+
+// Shared by all rebound copies of CountingAllocator.
+struct AllocationCount {
+  static inline int allocations = 0;
+};
+
+// Counts what reaches the upstream allocator.
+template <typename T>
+struct CountingAllocator : AllocationCount {
+  using value_type = T;
+
+  CountingAllocator() = default;
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+
+  T *allocate(std::size_t count) {
+    ++allocations;
+    return std::allocator<T>().allocate(count);
+  }
+
+  void deallocate(T *ptr, std::size_t count) {
+    std::allocator<T>().deallocate(ptr, count);
+  }
+
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+
+// Neither needs a default constructor nor converts from size_t.
+struct Heavy {
+  explicit Heavy(int id) : id(id) { ++constructed; }
+  Heavy(const Heavy &other) : id(other.id) { ++constructed; }
+  int id;
+  static inline int constructed = 0;
+};
+
+}  // namespace
+
+TEST(ListAllocator, EmptyListsDontAllocate) {
+  using Upstream = CountingAllocator<Heavy>;
+  int allocations = Upstream::allocations;
+  std::vector<s21::list<Heavy, Upstream>> chains(1000);
+  EXPECT_EQ(Upstream::allocations, allocations);
+  EXPECT_EQ(Heavy::constructed, 0);
+
+  chains[7].emplace_back(7);
+  chains[7].swap(chains[8]);
+  chains[9] = std::move(chains[8]);
+  EXPECT_TRUE(chains[8].empty());
+  EXPECT_EQ(chains[9].front().id, 7);
+  EXPECT_EQ(Heavy::constructed, 1);
+  EXPECT_TRUE(++chains[9].begin() == chains[9].end());
+}
+
+TEST(ListAllocator, PoolReusesNodesLastInFirstOut) {
+  pooled_list<std::string> my_list{"a", "b", "c"};
+  const std::string *freed = &my_list.back();
+  my_list.pop_back();
+  my_list.push_back("d");
+  EXPECT_EQ(&my_list.back(), freed);
+
+  my_list.erase(my_list.begin());
+  freed = &my_list.front();
+  my_list.pop_front();
+  my_list.push_front("e");
+  EXPECT_EQ(&my_list.front(), freed);
+  EXPECT_EQ(my_list.size(), 2);
+}
+
+TEST(ListAllocator, ReserveAllocatesOneChunk) {
+  using Upstream = CountingAllocator<int>;
+  s21::list<int, s21::pool_allocator<int, Upstream>> my_list;
+  my_list.reserve(1000);
+  int reserved = Upstream::allocations;
+
+  for (int i = 0; i < 1000; ++i) my_list.push_back(i);
+  EXPECT_EQ(Upstream::allocations, reserved);
+  const int *low = &my_list.front();
+  const int *high = low;
+  for (const int &item : my_list) {
+    low = std::min(low, &item);
+    high = std::max(high, &item);
+  }
+  std::size_t span = reinterpret_cast<const char *>(high) -
+                     reinterpret_cast<const char *>(low);
+  EXPECT_LT(span, 1000 * sizeof(s21::ListNode<int>));
+
+  // Growing past the reserve takes whole chunks, not one block per node.
+  for (int i = 0; i < 10000; ++i) my_list.push_back(i);
+  EXPECT_LT(Upstream::allocations - reserved, 20);
+}
+
+TEST(ListAllocator, ChunksAreAllocatedOnFirstUse) {
+  using Upstream = CountingAllocator<int>;
+  using counted_list = s21::list<int, s21::pool_allocator<int, Upstream>>;
+  int allocations = Upstream::allocations;
+  std::vector<counted_list> chains(1000);
+  // Just the pools themselves.
+  EXPECT_EQ(Upstream::allocations, allocations + 1000);
+  allocations = Upstream::allocations;
+  counted_list moved(std::move(chains[0]));
+  chains[1] = std::move(moved);
+  EXPECT_EQ(Upstream::allocations, allocations);
+
+  chains[2].push_back(2);
+  EXPECT_EQ(Upstream::allocations, allocations + 1);
+  EXPECT_FALSE(chains[2].get_allocator() == chains[3].get_allocator());
+}
+
+TEST(ListAllocator, CopiesStayEqual) {
+  s21::pool_allocator<int> pool;
+  s21::pool_allocator<int> copy(pool);
+  s21::pool_allocator<double> rebound(pool);
+  EXPECT_TRUE(copy == pool);
+  int *item = copy.allocate(1);
+  EXPECT_TRUE(copy == pool);
+  EXPECT_TRUE(rebound == pool);
+  pool.deallocate(item, 1);
+  EXPECT_EQ(pool.allocate(1), item);
+  copy.deallocate(item, 1);
+  EXPECT_FALSE(copy == s21::pool_allocator<int>());
+}
+
+TEST(ListAllocator, SharedPoolSplicesNodes) {
+  s21::pool_allocator<int> pool;
+  pooled_list<int> my_list1(pool);
+  pooled_list<int> my_list2(pool);
+  EXPECT_TRUE(my_list1.get_allocator() == my_list2.get_allocator());
+  my_list2.push_back(1);
+  my_list2.push_back(2);
+  const int *moved = &my_list2.front();
+  my_list1.splice(my_list1.end(), my_list2);
+  EXPECT_EQ(&my_list1.front(), moved);
+
+  // Lists with pools of their own can't share nodes, the elements move.
+  pooled_list<std::string> my_list3{"x"};
+  {
+    pooled_list<std::string> my_list4{"a", "b"};
+    EXPECT_FALSE(my_list3.get_allocator() == my_list4.get_allocator());
+    const std::string *old = &my_list4.front();
+    my_list3.splice(my_list3.begin(), my_list4);
+    EXPECT_NE(&my_list3.front(), old);
+    EXPECT_TRUE(my_list4.empty());
+  }
+  ASSERT_EQ(my_list3.size(), 3);
+  EXPECT_EQ(my_list3.front(), "a");
+  EXPECT_EQ(*++my_list3.begin(), "b");
+  EXPECT_EQ(my_list3.back(), "x");
+
+  // Copies keep sharing the pool, swaps take it along.
+  pooled_list<int> copy(my_list1);
+  copy.swap(my_list2);
+  EXPECT_EQ(my_list2.size(), 2);
+  EXPECT_TRUE(copy.empty());
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../s21_mapped_vector.h"
+
+namespace {
+
+struct Record {
+  std::uint64_t id;
+  double price;
+  std::int32_t quantity;
+};
+
+class MappedVectorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = ::testing::TempDir() + "s21_mapped_vector_" +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+            "_" + std::to_string(getpid());
+    unlink(path_.c_str());
+  }
+
+  void TearDown() override { unlink(path_.c_str()); }
+
+  std::size_t FileBytes() const {
+    struct stat info;
+    return stat(path_.c_str(), &info) == 0 ? info.st_size : 0;
+  }
+
+  std::string path_;
+};
+
+}  // namespace
+
+TEST_F(MappedVectorTest, CreatesAndReattaches) {
+  {
+    s21::mapped_vector<int> v(path_);
+    EXPECT_TRUE(v.is_open());
+    EXPECT_TRUE(v.empty());
+    for (int i = 0; i < 1000; ++i) v.push_back(i * i);
+    v.emplace_back(-1);
+    v.flush();
+  }
+
+  s21::mapped_vector<int> v(path_);
+  ASSERT_EQ(v.size(), 1001);
+  EXPECT_EQ(v[30], 900);
+  EXPECT_EQ(v.back(), -1);
+  EXPECT_EQ(v.front(), 0);
+  EXPECT_THROW(v.at(1001), std::out_of_range);
+  EXPECT_EQ(v.count(900), 1);
+  EXPECT_EQ(v.find(900) - v.begin(), 30);
+  EXPECT_EQ(v.min(), -1);
+  EXPECT_EQ(v.max(), 999 * 999);
+
+  v.pop_back();
+  v.push_back(7);
+  EXPECT_EQ(v.back(), 7);
+}
+
+TEST_F(MappedVectorTest, InsertEraseAndResize) {
+  s21::mapped_vector<int> v(path_);
+  v.insert(v.end(), {1, 2, 6});
+  v.insert(v.begin() + 2, 3, 4);
+  v.insert_many(v.begin(), -1, 0);
+  v.insert_many_back(7, 8);
+  v.emplace(v.begin() + 3, 3);
+  std::vector<int> expected = {-1, 0, 1, 3, 2, 4, 4, 4, 6, 7, 8};
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin(),
+                         expected.end()));
+
+  v.erase(v.begin() + 3);
+  v.erase(v.begin() + 5, v.begin() + 7);
+  EXPECT_EQ(s21::erase(v, 0), 1);
+  expected = {-1, 1, 2, 4, 6, 7, 8};
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin(),
+                         expected.end()));
+  EXPECT_THROW(v.erase(v.end()), std::out_of_range);
+  EXPECT_THROW(v.insert(v.end() + 1, 0), std::out_of_range);
+
+  v.resize(10, 5);
+  EXPECT_EQ(v[9], 5);
+  v.resize(2);
+  EXPECT_EQ(v.size(), 2);
+  v.clear();
+  EXPECT_THROW(v.pop_back(), std::length_error);
+}
+
+TEST_F(MappedVectorTest, GrowsAndShrinksTheFile) {
+  s21::mapped_vector<Record> v(path_);
+  v.reserve(100);
+  EXPECT_EQ(v.capacity(), 100);
+  EXPECT_GE(FileBytes(), 100 * sizeof(Record));
+
+  for (std::uint64_t i = 0; i < 200000; ++i)
+    v.push_back({i, i * 0.5, std::int32_t(i % 7)});
+  EXPECT_GE(v.capacity(), 200000);
+  EXPECT_EQ(v[123456].id, 123456);
+
+  v.resize(1000);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 1000);
+  std::size_t bytes = FileBytes();
+  EXPECT_GE(bytes, 1000 * sizeof(Record));
+  EXPECT_LT(bytes, 1001 * sizeof(Record) + 4096);
+  EXPECT_EQ(v.back().quantity, 999 % 7);
+}
+
+TEST_F(MappedVectorTest, ReadOnly) {
+  {
+    s21::mapped_vector<double> v(path_);
+    v.append_range(std::vector<double>{1.5, 2.5});
+  }
+
+  s21::mapped_vector<const double> v(path_);
+  EXPECT_TRUE(v.read_only());
+  EXPECT_FALSE(s21::mapped_vector<double>::read_only());
+  ASSERT_EQ(v.size(), 2);
+  EXPECT_EQ(v.sum(), 4.0);
+  EXPECT_EQ(*v.find(2.5), 2.5);
+  EXPECT_EQ(v.back(), 2.5);
+
+  // Only const access to a mapping without write access.
+  static_assert(std::is_same_v<decltype(v[0]), const double &>);
+  static_assert(std::is_same_v<decltype(v.front()), const double &>);
+  static_assert(std::is_same_v<decltype(v.begin()), const double *>);
+  static_assert(std::is_same_v<decltype(v.data()), const double *>);
+  static_assert(std::is_same_v<decltype(*v.find(1.5)), const double &>);
+
+  // Read-only vectors never create files.
+  unlink(path_.c_str());
+  EXPECT_THROW(s21::mapped_vector<const double>{path_}, std::system_error);
+}
+
+TEST_F(MappedVectorTest, RejectsForeignFiles) {
+  {
+    s21::mapped_vector<std::int32_t> v(path_);
+    v.push_back(1);
+  }
+  EXPECT_THROW(s21::mapped_vector<std::int64_t>{path_}, std::runtime_error);
+
+  std::ofstream(path_, std::ios::trunc) << "just some text";
+  EXPECT_THROW(s21::mapped_vector<std::int32_t>{path_}, std::runtime_error);
+}
+
+TEST_F(MappedVectorTest, MoveAndSwap) {
+  s21::mapped_vector<int> detached;
+  EXPECT_FALSE(detached.is_open());
+  EXPECT_THROW(detached.push_back(1), std::logic_error);
+
+  s21::mapped_vector<int> v(path_);
+  v.push_back(42);
+  detached = std::move(v);
+  EXPECT_FALSE(v.is_open());
+  EXPECT_EQ(detached.at(0), 42);
+
+  s21::mapped_vector<int> other(std::move(detached));
+  other.swap(v);
+  EXPECT_EQ(v[0], 42);
+  EXPECT_FALSE(other.is_open());
+}
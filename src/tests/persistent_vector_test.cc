@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_persistent_vector.h"
+
+TEST(PersistentVectorTest, MatchesStdVector) {
+  s21::persistent_vector<int> v;
+  std::vector<int> expected;
+  // Enough elements for three levels of branches above the chunks.
+  for (int i = 0; i < 40000; ++i) {
+    v.push_back(i);
+    expected.push_back(i);
+  }
+  for (int i = 0; i < 40000; i += 7) {
+    v.set(i, -i);
+    expected[i] = -i;
+  }
+  ASSERT_EQ(v.size(), expected.size());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  EXPECT_EQ(v.at(39999), 39999);
+  EXPECT_EQ(v.front(), 0);
+  EXPECT_THROW(v.at(40000), std::out_of_range);
+  EXPECT_THROW(v.set(40000, 1), std::out_of_range);
+
+  // Pop back across chunk and level boundaries.
+  while (v.size() > 5) {
+    v.pop_back();
+    expected.pop_back();
+    if (v.size() % 997 == 0) {
+      ASSERT_EQ(v.back(), expected.back());
+      ASSERT_EQ(v[v.size() / 2], expected[expected.size() / 2]);
+    }
+  }
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  while (!v.empty()) v.pop_back();
+  EXPECT_EQ(v.begin(), v.end());
+  EXPECT_THROW(v.pop_back(), std::length_error);
+  v.push_back(1);
+  EXPECT_EQ(v.back(), 1);
+}
+
+TEST(PersistentVectorTest, SnapshotsAreIndependent) {
+  s21::persistent_vector<std::string> v;
+  for (int i = 0; i < 2000; ++i) v.push_back(std::to_string(i));
+
+  s21::persistent_vector<std::string> snapshot = v.snapshot();
+  v.set(5, "five");
+  v.set(1999, "last");
+  v.push_back("extra");
+  s21::persistent_vector<std::string> copy = v;
+  copy.pop_back();
+  copy.set(1000, "changed");
+
+  EXPECT_EQ(snapshot.size(), 2000);
+  EXPECT_EQ(snapshot[5], "5");
+  EXPECT_EQ(snapshot[1999], "1999");
+  EXPECT_EQ(v[5], "five");
+  EXPECT_EQ(v[1000], "1000");
+  EXPECT_EQ(v.back(), "extra");
+  EXPECT_EQ(copy.back(), "last");
+  EXPECT_EQ(copy[1000], "changed");
+
+  v = snapshot;
+  EXPECT_EQ(v[5], "5");
+  s21::persistent_vector<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 2000);
+}
+
+TEST(PersistentVectorTest, ChunksAndReaderThreads) {
+  s21::persistent_vector<long> v;
+  for (long i = 0; i < 100000; ++i) v.push_back(i);
+
+  std::size_t chunks = 0;
+  long chunk_sum = 0;
+  v.for_each_chunk([&](s21::span<const long> chunk) {
+    EXPECT_LE(chunk.size(), s21::persistent_vector<long>::chunk_size);
+    chunk_sum = std::accumulate(chunk.begin(), chunk.end(), chunk_sum);
+    ++chunks;
+  });
+  EXPECT_EQ(chunks, (100000 + 31) / 32);
+  EXPECT_EQ(chunk_sum, 4999950000L);
+
+  std::vector<std::thread> readers;
+  std::vector<long> sums(4);
+  for (int t = 0; t < 4; ++t)
+    readers.emplace_back([snapshot = v.snapshot(), &sums, t] {
+      sums[t] = std::accumulate(snapshot.begin(), snapshot.end(), 0L);
+    });
+  for (long i = 0; i < 100000; i += 3) v.set(i, 0);
+  for (std::thread &reader : readers) reader.join();
+  for (long sum : sums) EXPECT_EQ(sum, 4999950000L);
+  EXPECT_LT(std::accumulate(v.begin(), v.end(), 0L), 4999950000L);
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_small_vector.h"
+#include "../s21_stack.h"
+
+TEST(SmallVectorTest, StaysInlineUpToN) {
+  s21::small_vector<int, 4> v;
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4);
+  for (int i = 0; i < 4; ++i) v.push_back(i);
+  EXPECT_TRUE(v.is_inline());
+  v.push_back(4);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(SmallVectorTest, InitializerList) {
+  s21::small_vector<std::string, 2> v{"a", "b", "c"};
+  std::vector<std::string> stdv{"a", "b", "c"};
+  ASSERT_EQ(v.size(), stdv.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v.at(i), stdv[i]);
+  EXPECT_THROW(v.at(3), std::out_of_range);
+}
+
+TEST(SmallVectorTest, InsertErase) {
+  s21::small_vector<int, 8> v{1, 2, 3};
+  std::vector<int> stdv{1, 2, 3};
+  v.insert(v.begin() + 1, 10);
+  stdv.insert(stdv.begin() + 1, 10);
+  v.insert(v.end(), 20);
+  stdv.insert(stdv.end(), 20);
+  v.erase(v.begin());
+  stdv.erase(stdv.begin());
+  ASSERT_EQ(v.size(), stdv.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], stdv[i]);
+  EXPECT_EQ(v.front(), 10);
+  EXPECT_EQ(v.back(), 20);
+}
+
+TEST(SmallVectorTest, ReserveAndShrink) {
+  s21::small_vector<std::string, 4> v{"a", "b"};
+  v.reserve(100);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 100);
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1], "b");
+}
+
+TEST(SmallVectorTest, CopyAndMove) {
+  s21::small_vector<std::string, 2> inline_v{"a"};
+  s21::small_vector<std::string, 2> heap_v{"x", "y", "z"};
+  s21::small_vector<std::string, 2> copy(heap_v);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy[2], "z");
+
+  s21::small_vector<std::string, 2> moved(std::move(inline_v));
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved[0], "a");
+  EXPECT_TRUE(inline_v.empty());
+
+  moved = std::move(heap_v);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(heap_v.empty());
+  EXPECT_TRUE(heap_v.is_inline());
+
+  copy = moved;
+  EXPECT_EQ(copy[0], "x");
+}
+
+TEST(SmallVectorTest, Swap) {
+  s21::small_vector<int, 2> a{1};
+  s21::small_vector<int, 2> b{1, 2, 3};
+  a.swap(b);
+  EXPECT_EQ(a.size(), 3);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_EQ(a[2], 3);
+  EXPECT_EQ(b[0], 1);
+}
+
+namespace {
+
+// Counts live objects. The construction that brings calls to 0 throws.
+struct ThrowsOnCall {
+  static inline int alive = 0;
+  static inline int calls = 0;
+  ThrowsOnCall() { Count(); }
+  ThrowsOnCall(const ThrowsOnCall &) { Count(); }
+  ThrowsOnCall &operator=(const ThrowsOnCall &) = default;
+  ~ThrowsOnCall() { --alive; }
+  void Count() {
+    if (++calls == 0) throw std::runtime_error("throwing element");
+    ++alive;
+  }
+};
+
+}  // namespace
+
+TEST(SmallVectorTest, ThrowingConstructorsDontLeak) {
+  // Inline and on the heap, each time the last element throws.
+  using small = s21::small_vector<ThrowsOnCall, 3>;
+  for (int size : {2, 5}) {
+    ThrowsOnCall::calls = -size;
+    EXPECT_THROW(small{std::size_t(size)}, std::runtime_error);
+    EXPECT_EQ(ThrowsOnCall::alive, 0);
+
+    ThrowsOnCall::calls = -100;
+    small source(size);
+    ThrowsOnCall::calls = -size;
+    EXPECT_THROW(small{source}, std::runtime_error);
+    EXPECT_EQ(ThrowsOnCall::alive, size);
+    ThrowsOnCall::calls = -size;
+    EXPECT_THROW(small(source.begin(), source.end()), std::runtime_error);
+    EXPECT_EQ(ThrowsOnCall::alive, size);
+
+    ThrowsOnCall::calls = -100;
+    small target(1);
+    ThrowsOnCall::calls = -size;
+    EXPECT_THROW(target = source, std::runtime_error);
+    // The elements copied before the throw stay in the target.
+    EXPECT_EQ(target.size(), size - 1);
+    EXPECT_EQ(ThrowsOnCall::alive, 2 * size - 1);
+  }
+  EXPECT_EQ(ThrowsOnCall::alive, 0);
+}
+
+TEST(SmallVectorTest, ClearPopBack) {
+  auto item = std::make_shared<int>(5);
+  {
+    s21::small_vector<std::shared_ptr<int>, 2> v;
+    for (int i = 0; i < 3; ++i) v.push_back(item);
+    EXPECT_EQ(item.use_count(), 4);
+    v.pop_back();
+    EXPECT_EQ(item.use_count(), 3);
+    v.clear();
+    EXPECT_EQ(item.use_count(), 1);
+    v.push_back(item);
+  }
+  EXPECT_EQ(item.use_count(), 1);
+  EXPECT_THROW((s21::small_vector<int, 1>().pop_back()), std::length_error);
+}
+
+TEST(SmallVectorTest, AsStackContainer) {
+  s21::stack<int, s21::small_vector<int, 16>> s{1, 2, 3};
+  EXPECT_EQ(s.size(), 3);
+  EXPECT_EQ(s.top(), 3);
+  s.push(4);
+  s.pop();
+  s.pop();
+  EXPECT_EQ(s.top(), 2);
+  s21::stack<int, s21::small_vector<int, 16>> other;
+  other.swap(s);
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(other.size(), 2);
+}
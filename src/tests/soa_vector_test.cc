@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "../s21_soa_vector.h"
+
+TEST(SoaVectorTest, ColumnsStayContiguous) {
+  s21::soa_vector<int, double, char> table;
+  for (int i = 0; i < 100; ++i)
+    table.emplace_back(i, i * 0.5, char('a' + i % 26));
+  ASSERT_EQ(table.size(), 100);
+  EXPECT_GE(table.capacity(), 100);
+
+  s21::span<int> ids = table.column<0>();
+  s21::span<double> prices = table.column<1>();
+  ASSERT_EQ(ids.size(), 100);
+  EXPECT_EQ(std::accumulate(ids.begin(), ids.end(), 0), 4950);
+  EXPECT_EQ(&prices[99] - &prices[0], 99);
+  EXPECT_EQ(table.column<2>()[27], 'b');
+  for (double &price : prices) price *= 2;
+  EXPECT_EQ(std::get<1>(table[10]), 10.0);
+}
+
+TEST(SoaVectorTest, ZippedRows) {
+  s21::soa_vector<std::string, int> table{{"apple", 3}, {"kiwi", 5}};
+  table.push_back({"fig", 7});
+  std::tuple<std::string, int> row{"date", 1};
+  table.push_back(std::move(row));
+
+  for (auto [name, count] : table) count += int(name.size());
+  EXPECT_EQ(std::get<1>(table.at(0)), 8);
+  EXPECT_EQ(std::get<1>(table.back()), 5);
+  EXPECT_EQ(std::get<0>(table.front()), "apple");
+
+  const auto &view = table;
+  int total = 0;
+  for (auto it = view.begin(); it != view.end(); ++it)
+    total += std::get<1>(*it);
+  EXPECT_EQ(total, 8 + 9 + 10 + 5);
+  EXPECT_EQ(view.end() - view.begin(), 4);
+
+  table.erase(1);
+  EXPECT_EQ(std::get<0>(table[1]), "fig");
+  table.pop_back();
+  EXPECT_EQ(table.size(), 2);
+  EXPECT_EQ(table.column<0>().size(), table.column<1>().size());
+  EXPECT_THROW(table.at(2), std::out_of_range);
+  table.clear();
+  EXPECT_THROW(table.front(), std::out_of_range);
+  EXPECT_THROW(table.pop_back(), std::length_error);
+}
+
+struct ThrowsOnCopy {
+  ThrowsOnCopy() = default;
+  ThrowsOnCopy(const ThrowsOnCopy &) { throw std::runtime_error("copy"); }
+  ThrowsOnCopy(ThrowsOnCopy &&) = default;
+  ThrowsOnCopy &operator=(const ThrowsOnCopy &) = default;
+  ThrowsOnCopy &operator=(ThrowsOnCopy &&) = default;
+};
+
+// The default construction that brings countdown to 0 throws.
+struct ThrowsOnDefault {
+  static inline int countdown = 0;
+  ThrowsOnDefault() {
+    if (--countdown == 0) throw std::runtime_error("default");
+  }
+};
+
+TEST(SoaVectorTest, FailedResizeKeepsColumnsInStep) {
+  ThrowsOnDefault::countdown = -1;
+  s21::soa_vector<int, ThrowsOnDefault, std::string> table(2);
+  // Throws halfway through the second column.
+  ThrowsOnDefault::countdown = 3;
+  EXPECT_THROW(table.resize(10), std::runtime_error);
+  EXPECT_EQ(table.size(), 2);
+  EXPECT_EQ(table.column<0>().size(), 2);
+  EXPECT_EQ(table.column<1>().size(), 2);
+  EXPECT_EQ(table.column<2>().size(), 2);
+
+  ThrowsOnDefault::countdown = -1;
+  table.resize(4);
+  EXPECT_EQ(table.column<2>().size(), 4);
+}
+
+TEST(SoaVectorTest, FailedPushKeepsColumnsInStep) {
+  s21::soa_vector<std::string, ThrowsOnCopy> table;
+  table.emplace_back("moved", ThrowsOnCopy());
+  ThrowsOnCopy item;
+  EXPECT_THROW(table.emplace_back("copied", item), std::runtime_error);
+  EXPECT_EQ(table.size(), 1);
+  EXPECT_EQ(table.column<0>().size(), 1);
+  EXPECT_EQ(table.column<0>()[0], "moved");
+
+  s21::soa_vector<long, float> sized(5);
+  EXPECT_EQ(sized.size(), 5);
+  EXPECT_EQ(sized.column<1>()[4], 0.0f);
+  sized.reserve(64);
+  EXPECT_GE(sized.capacity(), 64);
+  sized.shrink_to_fit();
+  EXPECT_EQ(sized.capacity(), 5);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../s21_static_vector.h"
+
+namespace {
+
+constexpr s21::static_vector<int, 8> MakeSquares() {
+  s21::static_vector<int, 8> v;
+  for (int i = 0; i < 5; ++i) v.push_back(i * i);
+  v.insert(v.begin(), -1);
+  v.erase(v.begin() + 1);
+  return v;
+}
+
+// Counts live objects. The copy or move that brings calls to 0 throws.
+struct ThrowsOnCall {
+  static inline int alive = 0;
+  static inline int calls = 0;
+  ThrowsOnCall() { ++alive; }
+  ThrowsOnCall(const ThrowsOnCall &) { Count(); }
+  ThrowsOnCall(ThrowsOnCall &&) { Count(); }
+  ~ThrowsOnCall() { --alive; }
+  void Count() {
+    if (++calls == 0) throw std::runtime_error("throwing element");
+    ++alive;
+  }
+};
+
+}  // namespace
+
+TEST(StaticVectorTest, Constexpr) {
+  constexpr auto squares = MakeSquares();
+  static_assert(squares.size() == 5);
+  static_assert(squares.front() == -1);
+  static_assert(squares.back() == 16);
+  static_assert(squares[2] == 4);
+  static_assert(squares.capacity() == 8);
+  EXPECT_EQ(squares.at(3), 9);
+}
+
+TEST(StaticVectorTest, PushPopAndOverflow) {
+  s21::static_vector<int, 3> v{1, 2};
+  v.push_back(3);
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW(v.push_back(4), std::length_error);
+  EXPECT_THROW(v.insert(v.begin(), 4), std::length_error);
+  EXPECT_FALSE(v.try_push_back(4));
+  EXPECT_EQ(v.try_insert(v.begin(), 4), v.end());
+  EXPECT_EQ(v.size(), 3);
+  v.pop_back();
+  EXPECT_TRUE(v.try_push_back(5));
+  EXPECT_EQ(v.back(), 5);
+  v.clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_THROW(v.pop_back(), std::length_error);
+  EXPECT_THROW(v.front(), std::out_of_range);
+  EXPECT_THROW(v.reserve(4), std::length_error);
+  EXPECT_THROW((s21::static_vector<int, 2>(3)), std::length_error);
+}
+
+TEST(StaticVectorTest, NonTrivialElements) {
+  s21::static_vector<std::string, 4> v{"b", "d"};
+  std::vector<std::string> stdv{"b", "d"};
+  v.insert(v.begin(), "a");
+  stdv.insert(stdv.begin(), "a");
+  v.insert(v.begin() + 2, "c");
+  stdv.insert(stdv.begin() + 2, "c");
+  ASSERT_EQ(v.size(), stdv.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], stdv[i]);
+  v.erase(v.begin() + 1);
+  EXPECT_EQ(v[1], "c");
+  EXPECT_THROW(v.at(3), std::out_of_range);
+}
+
+TEST(StaticVectorTest, CopyMoveSwap) {
+  s21::static_vector<std::string, 4> a{"x", "y"};
+  s21::static_vector<std::string, 4> b(a);
+  EXPECT_EQ(b.size(), 2);
+  EXPECT_EQ(b[1], "y");
+
+  s21::static_vector<std::string, 4> c(std::move(a));
+  EXPECT_EQ(c.size(), 2);
+  EXPECT_TRUE(a.empty());
+
+  s21::static_vector<std::string, 4> d{"z"};
+  d.swap(c);
+  EXPECT_EQ(d.size(), 2);
+  EXPECT_EQ(c.size(), 1);
+  EXPECT_EQ(c[0], "z");
+  EXPECT_EQ(d[0], "x");
+
+  a = d;
+  EXPECT_EQ(a[1], "y");
+}
+
+TEST(StaticVectorTest, ThrowingCopiesDontLeak) {
+  {
+    s21::static_vector<ThrowsOnCall, 4> v(3);
+    ThrowsOnCall element;
+    ThrowsOnCall::calls = -1;
+    EXPECT_THROW(v.push_back(element), std::runtime_error);
+    ThrowsOnCall::calls = -1;
+    EXPECT_THROW(v.try_push_back(std::move(element)), std::runtime_error);
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(ThrowsOnCall::alive, 4);
+
+    ThrowsOnCall::calls = -3;
+    EXPECT_THROW((s21::static_vector<ThrowsOnCall, 4>(v)), std::runtime_error);
+    EXPECT_EQ(ThrowsOnCall::alive, 4);
+    ThrowsOnCall::calls = -3;
+    EXPECT_THROW((s21::static_vector<ThrowsOnCall, 4>(std::move(v))),
+                 std::runtime_error);
+    EXPECT_EQ(ThrowsOnCall::alive, 4);
+  }
+  EXPECT_EQ(ThrowsOnCall::alive, 0);
+}
+
+TEST(StaticVectorTest, NoHeapFootprint) {
+  s21::static_vector<int, 16> v(16);
+  EXPECT_GE(sizeof(v), 16 * sizeof(int));
+  for (auto item : v) EXPECT_EQ(item, 0);
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "../s21_unrolled_list.h"
+
+namespace {
+
+template <typename T, typename Reference>
+void ExpectSameElements(const s21::unrolled_list<T> &list,
+                        const Reference &expected) {
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = expected.begin();
+  for (const T &value : list) EXPECT_EQ(value, *it++);
+
+  // And backwards.
+  auto rit = expected.end();
+  for (auto lit = list.end(); lit != list.begin();) EXPECT_EQ(*--lit, *--rit);
+}
+
+}  // namespace
+
+TEST(UnrolledListTest, PushAndPopAtBothEnds) {
+  s21::unrolled_list<int> list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.block_count(), 0);
+  EXPECT_THROW(list.front(), std::out_of_range);
+  EXPECT_THROW(list.pop_back(), std::out_of_range);
+  EXPECT_THROW(list.pop_front(), std::out_of_range);
+
+  std::list<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    list.push_back(i);
+    list.push_front(-i);
+    expected.push_back(i);
+    expected.push_front(-i);
+  }
+  ExpectSameElements(list, expected);
+  EXPECT_EQ(list.front(), -999);
+  EXPECT_EQ(list.back(), 999);
+  EXPECT_GE(list.block_count(), 2000 / list.block_capacity);
+
+  for (int i = 0; i < 900; ++i) {
+    list.pop_back();
+    list.pop_front();
+    expected.pop_back();
+    expected.pop_front();
+  }
+  ExpectSameElements(list, expected);
+
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.block_count(), 0);
+  EXPECT_TRUE(list.begin() == list.end());
+}
+
+TEST(UnrolledListTest, BlocksFillCacheLines) {
+  EXPECT_EQ(s21::unrolled_list<int>::block_capacity, 26);
+  EXPECT_EQ(s21::unrolled_list<char>::block_capacity, 104);
+  EXPECT_EQ((s21::unrolled_list<std::array<char, 100>>::block_capacity), 4);
+
+  s21::unrolled_list<int> list;
+  for (int i = 0; i < 260; ++i) list.push_back(i);
+  EXPECT_EQ(list.block_count(), 10);
+  for (int i = 0; i < 260; ++i) list.push_front(i);
+  EXPECT_EQ(list.block_count(), 20);
+}
+
+TEST(UnrolledListTest, InsertAndEraseMatchStdList) {
+  s21::unrolled_list<int> list;
+  std::list<int> expected;
+  std::mt19937 random(21);
+  for (int step = 0; step < 20000; ++step) {
+    std::size_t at = list.empty() ? 0 : random() % (list.size() + 1);
+    auto it = std::next(list.begin(), at);
+    auto eit = std::next(expected.begin(), at);
+    if (random() % 5 < 3 || at == list.size()) {
+      int value = int(random() % 1000);
+      EXPECT_EQ(*list.insert(it, value), value);
+      expected.insert(eit, value);
+    } else {
+      auto next = list.erase(it);
+      auto enext = expected.erase(eit);
+      if (enext == expected.end())
+        EXPECT_TRUE(next == list.end());
+      else
+        EXPECT_EQ(*next, *enext);
+    }
+  }
+  ExpectSameElements(list, expected);
+}
+
+TEST(UnrolledListTest, EraseMergesBlocks) {
+  s21::unrolled_list<int> list;
+  for (int i = 0; i < 10000; ++i) list.push_back(i);
+  std::size_t full = list.block_count();
+
+  // Erase every other element.
+  for (auto it = list.begin(); it != list.end(); ++it) it = list.erase(it);
+  EXPECT_EQ(list.size(), 5000);
+  EXPECT_EQ(list.front(), 1);
+  EXPECT_LT(list.block_count(), full * 3 / 4);
+
+  while (list.size() > 1) list.erase(std::next(list.begin()));
+  EXPECT_EQ(list.block_count(), 1);
+  list.pop_back();
+  EXPECT_EQ(list.block_count(), 0);
+}
+
+TEST(UnrolledListTest, InsertFromOwnElements) {
+  s21::unrolled_list<std::string> list;
+  for (int i = 0; i < 28; ++i) list.push_back(std::string(40, 'a' + i % 26));
+  // The block is full, the value is taken before it gets split.
+  for (int i = 0; i < 100; ++i) list.insert(list.begin(), list.back());
+  EXPECT_EQ(list.front(), std::string(40, 'b'));
+  EXPECT_EQ(list.size(), 128);
+  for (auto it = list.begin(); it != std::next(list.begin(), 100); ++it)
+    EXPECT_EQ(*it, list.back());
+}
+
+TEST(UnrolledListTest, MoveOnlyElements) {
+  s21::unrolled_list<std::unique_ptr<int>> list;
+  for (int i = 0; i < 100; ++i) {
+    list.push_back(std::make_unique<int>(i));
+    list.emplace_front(new int(-i));
+  }
+  list.emplace(std::next(list.begin(), 100), new int(1000));
+  EXPECT_EQ(*list.front(), -99);
+  EXPECT_EQ(**std::next(list.begin(), 100), 1000);
+
+  s21::unrolled_list<std::unique_ptr<int>> moved(std::move(list));
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(moved.size(), 201);
+  list = std::move(moved);
+  EXPECT_EQ(*list.back(), 99);
+}
+
+TEST(UnrolledListTest, CopySwapAndSplice) {
+  s21::unrolled_list<std::string> a = {"one", "two", "three"};
+  s21::unrolled_list<std::string> b(a);
+  b.push_back("four");
+  a = b;
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(a.back(), "four");
+
+  s21::unrolled_list<std::string> c = {"x"};
+  c.swap(a);
+  EXPECT_EQ(c.size(), 4);
+  EXPECT_EQ(a.front(), "x");
+  a.push_back("y");
+  EXPECT_EQ(a.back(), "y");
+
+  std::list<std::string> expected;
+  s21::unrolled_list<std::string> spliced;
+  for (int i = 0; i < 100; ++i) {
+    spliced.push_back(std::to_string(i));
+    expected.push_back(std::to_string(i));
+  }
+  expected.insert(std::next(expected.begin(), 42), {"one", "two", "three",
+                                                    "four"});
+  std::size_t blocks = spliced.block_count() + c.block_count();
+  spliced.splice(std::next(spliced.begin(), 42), c);
+  EXPECT_TRUE(c.empty());
+  EXPECT_EQ(c.block_count(), 0);
+  // Only the block at the splice point was split.
+  EXPECT_EQ(spliced.block_count(), blocks + 1);
+  ExpectSameElements(spliced, expected);
+
+  spliced.splice(spliced.end(), a);
+  spliced.splice(spliced.begin(), c);
+  expected.push_back("x");
+  expected.push_back("y");
+  ExpectSameElements(spliced, expected);
+}
+
+TEST(UnrolledListTest, ConstIterators) {
+  const s21::unrolled_list<int> list = {1, 2, 3};
+  s21::unrolled_list<int>::const_iterator it = list.begin();
+  EXPECT_EQ(*it++, 1);
+  EXPECT_EQ(*++it, 3);
+  EXPECT_TRUE(++it == list.end());
+  EXPECT_EQ(list.back(), 3);
+
+  s21::unrolled_list<int> mutable_list = {4};
+  s21::unrolled_list<int>::const_iterator converted = mutable_list.begin();
+  mutable_list.insert(converted, 3);
+  EXPECT_EQ(mutable_list.front(), 3);
+  EXPECT_EQ(std::distance(mutable_list.begin(), mutable_list.end()), 2);
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_varlen_vector.h"
+
+using namespace std::string_literals;
+
+TEST(VarlenVectorTest, PushBackAndAccess) {
+  s21::varlen_vector<> keys;
+  EXPECT_TRUE(keys.empty());
+  keys.push_back("alpha");
+  keys.push_back("");
+  keys.push_back("be\0ta"s);
+  std::string owned = "gamma";
+  keys.push_back(owned);
+  owned.clear();
+
+  ASSERT_EQ(keys.size(), 4);
+  EXPECT_EQ(keys[0], "alpha");
+  EXPECT_TRUE(keys[1].empty());
+  EXPECT_EQ(keys.at(2), "be\0ta"s);
+  EXPECT_EQ(keys.back(), "gamma");
+  EXPECT_EQ(keys.front(), "alpha");
+  EXPECT_EQ(keys.bytes(), "alphabe\0tagamma"s);
+  EXPECT_THROW(keys.at(4), std::out_of_range);
+
+  keys.pop_back();
+  EXPECT_EQ(keys.size(), 3);
+  EXPECT_EQ(keys.bytes().size(), 10);
+  keys.clear();
+  EXPECT_THROW(keys.back(), std::out_of_range);
+  EXPECT_THROW(keys.pop_back(), std::length_error);
+}
+
+TEST(VarlenVectorTest, TwoAllocationsWhenReserved) {
+  std::vector<std::string> source;
+  std::size_t bytes = 0;
+  for (int i = 0; i < 10000; ++i) {
+    source.push_back("key-" + std::to_string(i * 7919));
+    bytes += source.back().size();
+  }
+
+  s21::varlen_vector<> keys;
+  keys.reserve(source.size());
+  keys.reserve_bytes(bytes);
+  const char *arena = keys.bytes().data();
+  for (const std::string &key : source) keys.push_back(key);
+  EXPECT_EQ(keys.bytes().data(), arena);
+  EXPECT_EQ(keys.capacity(), source.size());
+  EXPECT_EQ(keys.capacity_bytes(), bytes);
+
+  ASSERT_EQ(keys.size(), source.size());
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), source.begin()));
+  EXPECT_EQ(*std::find(keys.begin(), keys.end(), "key-7919"), "key-7919");
+}
+
+TEST(VarlenVectorTest, RandomAccessIterators) {
+  s21::varlen_vector<> words{"ant", "bee", "cat", "dog", "eel"};
+  auto first = words.begin();
+  auto last = words.end();
+  EXPECT_EQ(*(2 + first), "cat");
+  EXPECT_TRUE(last > first && last >= first && first <= first);
+  EXPECT_FALSE(first > last || first >= last || last <= first);
+  EXPECT_EQ(*std::lower_bound(first, last, "cow"), "dog");
+  EXPECT_TRUE(std::binary_search(first, last, "eel"));
+  EXPECT_EQ(*std::make_reverse_iterator(last), "eel");
+  EXPECT_EQ(std::prev(last, 4)[1], "cat");
+}
+
+TEST(VarlenVectorTest, SelfAppendAndInitList) {
+  s21::varlen_vector<std::size_t> words{"one", "two", "three"};
+  EXPECT_EQ(words.size(), 3);
+  for (int i = 0; i < 20; ++i) words.push_back(words[i % 3]);
+  EXPECT_EQ(words[22], "two");
+  EXPECT_EQ(words[21], "one");
+  words.push_back(words.bytes().substr(3, 6));
+  EXPECT_EQ(words.back(), "twothr");
+
+  s21::varlen_vector<std::size_t> other;
+  other.swap(words);
+  EXPECT_TRUE(words.empty());
+  EXPECT_EQ(other.size(), 24);
+  other.shrink_to_fit();
+  EXPECT_EQ(other.capacity(), 24);
+
+  s21::varlen_vector<std::uint8_t> tiny;
+  tiny.push_back(std::string(200, 'x'));
+  EXPECT_THROW(tiny.push_back(std::string(60, 'y')), std::length_error);
+  EXPECT_EQ(tiny.size(), 1);
+}
@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "../s21_vector.h"
 using namespace s21;
 TEST(vectorTest, Createvector) {
@@ -173,4 +180,652 @@ TEST(vectorTest, ShrinkToFit) {
   v.push_back(1);
   v.shrink_to_fit();
   EXPECT_EQ(v.capacity(), v.size());
-}
\ No newline at end of file
+}
+
+struct Tracked {
+  static int alive;
+  static int constructed;
+  int value;
+  Tracked() : value(0) { ++alive, ++constructed; }
+  Tracked(int v) : value(v) { ++alive, ++constructed; }
+  Tracked(const Tracked &other) : value(other.value) {
+    ++alive, ++constructed;
+  }
+  Tracked(Tracked &&other) noexcept : value(other.value) {
+    ++alive, ++constructed;
+  }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) = default;
+  ~Tracked() { --alive; }
+  static void Reset() { alive = constructed = 0; }
+};
+int Tracked::alive = 0;
+int Tracked::constructed = 0;
+
+TEST(vectorTest, ReserveConstructsNothing) {
+  Tracked::Reset();
+  {
+    vector<Tracked> v;
+    v.reserve(1000);
+    EXPECT_EQ(Tracked::constructed, 0);
+    v.push_back(Tracked(1));
+    EXPECT_EQ(Tracked::alive, 1);
+    EXPECT_EQ(v.capacity(), 1000);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(vectorTest, ClearAndPopBackDestroy) {
+  Tracked::Reset();
+  vector<Tracked> v(5);
+  EXPECT_EQ(Tracked::alive, 5);
+  v.pop_back();
+  EXPECT_EQ(Tracked::alive, 4);
+  v.erase(v.begin());
+  EXPECT_EQ(Tracked::alive, 3);
+  v.clear();
+  EXPECT_EQ(Tracked::alive, 0);
+  EXPECT_EQ(v.capacity(), 5);
+}
+
+struct ThrowsOnThird {
+  static int alive;
+  static int calls;
+  ThrowsOnThird() { Count(); }
+  ThrowsOnThird(const ThrowsOnThird &) { Count(); }
+  ~ThrowsOnThird() { --alive; }
+  void Count() {
+    if (++calls == 3) throw std::runtime_error("third element");
+    ++alive;
+  }
+};
+int ThrowsOnThird::alive = 0;
+int ThrowsOnThird::calls = 0;
+
+TEST(vectorTest, ThrowingConstructorsDontLeak) {
+  ThrowsOnThird::calls = 0;
+  EXPECT_THROW(vector<ThrowsOnThird>(5), std::runtime_error);
+  EXPECT_EQ(ThrowsOnThird::alive, 0);
+
+  ThrowsOnThird::calls = -3;
+  std::initializer_list<ThrowsOnThird> items = {{}, {}, {}};
+  EXPECT_EQ(ThrowsOnThird::alive, 3);
+  EXPECT_THROW(vector<ThrowsOnThird>{items}, std::runtime_error);
+  EXPECT_EQ(ThrowsOnThird::alive, 3);
+
+  ThrowsOnThird::calls = -4;
+  vector<ThrowsOnThird> source(4);
+  EXPECT_EQ(ThrowsOnThird::alive, 7);
+  EXPECT_THROW(vector<ThrowsOnThird>{source}, std::runtime_error);
+  EXPECT_EQ(ThrowsOnThird::alive, 7);
+}
+
+TEST(vectorTest, StatelessAllocatorTakesNoSpace) {
+  EXPECT_EQ(sizeof(vector<int>), 3 * sizeof(void *));
+  EXPECT_EQ(sizeof(vector<std::string>), 3 * sizeof(void *));
+}
+
+TEST(vectorTest, InsertAliasedElement) {
+  vector<std::string> v{"a", "b", "c"};
+  v.insert(v.begin(), v[2]);
+  v.insert(v.begin() + 1, v[0]);
+  ASSERT_EQ(v.size(), 5);
+  EXPECT_EQ(v[0], "c");
+  EXPECT_EQ(v[1], "c");
+  EXPECT_EQ(v[2], "a");
+  EXPECT_EQ(v[4], "c");
+}
+
+TEST(vectorTest, CustomAllocator) {
+  vector<int, std::allocator<int>> v(std::allocator<int>{});
+  for (int i = 0; i < 10; ++i) v.push_back(i);
+  vector<int, std::allocator<int>> copy(v);
+  EXPECT_EQ(copy.size(), 10);
+  EXPECT_EQ(copy[9], 9);
+  copy = vector<int, std::allocator<int>>{1, 2};
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy[1], 2);
+}
+
+struct CopyPreferred {
+  static int moves;
+  int value;
+  CopyPreferred(int v) : value(v) {}
+  CopyPreferred(const CopyPreferred &) = default;
+  CopyPreferred(CopyPreferred &&other) : value(other.value) { ++moves; }
+  CopyPreferred &operator=(const CopyPreferred &) = default;
+  CopyPreferred &operator=(CopyPreferred &&) = default;
+};
+int CopyPreferred::moves = 0;
+
+TEST(vectorTest, GrowthCopiesThrowingMoves) {
+  vector<CopyPreferred> v;
+  for (int i = 0; i < 100; ++i) v.push_back(CopyPreferred(i));
+  CopyPreferred::moves = 0;
+  v.reserve(1000);
+  EXPECT_EQ(CopyPreferred::moves, 0);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(v[i].value, i);
+}
+
+TEST(vectorTest, TrivialInsertEraseShift) {
+  struct Point {
+    int x, y;
+  };
+  vector<Point> v;
+  for (int i = 0; i < 10; ++i) v.push_back({i, -i});
+  v.insert(v.begin() + 3, Point{100, 100});
+  v.erase(v.begin());
+  ASSERT_EQ(v.size(), 10);
+  EXPECT_EQ(v[0].x, 1);
+  EXPECT_EQ(v[2].x, 100);
+  EXPECT_EQ(v[3].x, 3);
+  EXPECT_EQ(v[9].y, -9);
+}
+
+TEST(vectorTest, GrowthPolicies) {
+  vector<int, std::allocator<int>, growth::one_and_half> v;
+  std::vector<size_t> capacities;
+  for (int i = 0; i < 10; ++i) {
+    v.push_back(i);
+    if (capacities.empty() || capacities.back() != v.capacity())
+      capacities.push_back(v.capacity());
+  }
+  EXPECT_EQ(capacities, (std::vector<size_t>{1, 2, 4, 7, 11}));
+
+  vector<int, std::allocator<int>, growth::page_rounded<>> paged;
+  paged.push_back(1);
+  EXPECT_EQ(paged.capacity(), 4096 / sizeof(int));
+  paged.shrink_to_fit();
+  EXPECT_EQ(paged.capacity(), 4096 / sizeof(int));
+  for (int i = 0; i < 2000; ++i) paged.push_back(i);
+  EXPECT_EQ(paged.capacity() * sizeof(int) % 4096, 0);
+}
+
+TEST(vectorTest, LargeVectorGrowsInPlace) {
+  large_vector<uint64_t> v;
+  const uint64_t count = 3 * growth::kLargeBufferBytes / sizeof(uint64_t);
+  for (uint64_t i = 0; i < count; ++i) v.push_back(i * 3);
+  EXPECT_TRUE(remap_allocator<uint64_t>::IsMapped(v.capacity()));
+  EXPECT_EQ(v.size(), count);
+  bool intact = true;
+  for (uint64_t i = 0; i < count; ++i) intact = intact && v[i] == i * 3;
+  EXPECT_TRUE(intact);
+
+  v.insert(v.begin() + 1, 42);
+  EXPECT_EQ(v[1], 42);
+  EXPECT_EQ(v[2], 3);
+  v.shrink_to_fit();
+  EXPECT_GE(v.capacity(), v.size());
+  EXPECT_EQ(v.back(), (count - 1) * 3);
+
+  large_vector<uint64_t> copy(v);
+  EXPECT_EQ(copy.size(), v.size());
+  while (copy.size() > 10) copy.pop_back();
+  copy.shrink_to_fit();
+  EXPECT_FALSE(remap_allocator<uint64_t>::IsMapped(copy.capacity()));
+  EXPECT_EQ(copy[9], 24);
+}
+
+TEST(vectorTest, EmplaceMoveOnly) {
+  vector<std::unique_ptr<int>> v;
+  v.emplace_back(new int(2));
+  v.push_back(std::make_unique<int>(4));
+  v.emplace(v.begin(), new int(1));
+  v.insert(v.begin() + 2, std::make_unique<int>(3));
+  for (int i = 0; i < 20; ++i) v.emplace_back(std::make_unique<int>(5 + i));
+  ASSERT_EQ(v.size(), 24);
+  for (int i = 0; i < 24; ++i) EXPECT_EQ(*v[i], i + 1);
+  v.erase(v.begin());
+  EXPECT_EQ(*v.front(), 2);
+
+  vector<std::unique_ptr<int>> moved(std::move(v));
+  EXPECT_EQ(*moved.back(), 24);
+}
+
+TEST(vectorTest, EmplaceBuildsInPlace) {
+  Tracked::Reset();
+  vector<Tracked> v;
+  v.reserve(4);
+  Tracked &last = v.emplace_back(7);
+  EXPECT_EQ(last.value, 7);
+  EXPECT_EQ(Tracked::constructed, 1);
+  v.emplace(v.end(), 8);
+  EXPECT_EQ(Tracked::constructed, 2);
+  EXPECT_EQ(v[1].value, 8);
+}
+
+template <typename T>
+struct CountingAllocator : std::allocator<T> {
+  static int allocations;
+  template <typename U>
+  struct rebind {
+    using other = CountingAllocator<U>;
+  };
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+  T *allocate(size_t count) {
+    ++allocations;
+    return std::allocator<T>::allocate(count);
+  }
+};
+template <typename T>
+int CountingAllocator<T>::allocations = 0;
+
+template <typename V, typename S>
+void ExpectSameElements(const V &v, const S &stdv) {
+  ASSERT_EQ(v.size(), stdv.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], stdv[i]);
+}
+
+TEST(vectorTest, RangeInsert) {
+  std::vector<std::string> source{"x", "y", "z", "w"};
+  for (size_t reserve : {0, 6, 20}) {
+    for (size_t at = 0; at <= 3; ++at) {
+      vector<std::string> v{"a", "b", "c"};
+      std::vector<std::string> stdv{"a", "b", "c"};
+      v.reserve(reserve);
+      auto it = v.insert(v.begin() + at, source.begin(), source.end());
+      stdv.insert(stdv.begin() + at, source.begin(), source.end());
+      EXPECT_EQ(it, v.begin() + at);
+      ExpectSameElements(v, stdv);
+    }
+  }
+}
+
+TEST(vectorTest, CountInsert) {
+  vector<int> v{1, 2, 3};
+  std::vector<int> stdv{1, 2, 3};
+  v.insert(v.begin() + 1, 5, v[2]);
+  stdv.insert(stdv.begin() + 1, 5, stdv[2]);
+  ExpectSameElements(v, stdv);
+  v.insert(v.end(), 0, 9);
+  ExpectSameElements(v, stdv);
+
+  vector<std::string> strings{"a", "b"};
+  strings.reserve(10);
+  strings.insert(strings.begin(), 3, strings[1]);
+  ExpectSameElements(strings,
+                     std::vector<std::string>{"b", "b", "b", "a", "b"});
+}
+
+TEST(vectorTest, InputIteratorInsert) {
+  std::istringstream stream("4 5 6");
+  vector<int> v{1, 2, 3};
+  v.insert(v.begin() + 1, std::istream_iterator<int>(stream),
+           std::istream_iterator<int>());
+  ExpectSameElements(v, std::vector<int>{1, 4, 5, 6, 2, 3});
+}
+
+TEST(vectorTest, AppendRangeAllocatesOnce) {
+  std::vector<int> source(1000);
+  for (int i = 0; i < 1000; ++i) source[i] = i;
+  vector<int, CountingAllocator<int>> v;
+  v.push_back(-1);
+  CountingAllocator<int>::allocations = 0;
+  v.append_range(source);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  EXPECT_EQ(v.size(), 1001);
+  EXPECT_EQ(v[1000], 999);
+  v.insert(v.begin(), {7, 8});
+  EXPECT_EQ(v[1], 8);
+  EXPECT_EQ(v[2], -1);
+}
+
+TEST(vectorTest, InsertMany) {
+  vector<std::string> v{"a", "e"};
+  auto it = v.insert_many(v.begin() + 1, "b", std::string("c"), v[1]);
+  EXPECT_EQ(*it, "b");
+  v.insert_many_back("f", "g");
+  v.insert_many(v.end());
+  ExpectSameElements(
+      v, std::vector<std::string>{"a", "b", "c", "e", "e", "f", "g"});
+
+  vector<std::unique_ptr<int>> owners;
+  owners.insert_many_back(std::make_unique<int>(1), std::make_unique<int>(2));
+  EXPECT_EQ(*owners[1], 2);
+}
+
+TEST(vectorTest, LargeVectorAppend) {
+  std::vector<uint32_t> chunk(growth::kLargeBufferBytes / sizeof(uint32_t), 7);
+  large_vector<uint32_t> v;
+  for (int i = 0; i < 3; ++i) v.append_range(chunk);
+  EXPECT_EQ(v.size(), 3 * chunk.size());
+  v.insert(v.begin(), 2, 1);
+  EXPECT_EQ(v[1], 1);
+  EXPECT_EQ(v[2], 7);
+  EXPECT_EQ(v.back(), 7);
+}
+
+TEST(vectorTest, RangeErase) {
+  vector<std::string> v{"a", "b", "c", "d", "e"};
+  std::vector<std::string> stdv{"a", "b", "c", "d", "e"};
+  auto it = v.erase(v.begin() + 1, v.begin() + 3);
+  stdv.erase(stdv.begin() + 1, stdv.begin() + 3);
+  EXPECT_EQ(*it, "d");
+  ExpectSameElements(v, stdv);
+  v.erase(v.begin(), v.begin());
+  ExpectSameElements(v, stdv);
+  v.erase(v.begin() + 1, v.end());
+  stdv.erase(stdv.begin() + 1, stdv.end());
+  ExpectSameElements(v, stdv);
+  EXPECT_THROW(v.erase(v.begin(), v.begin() + 2), std::out_of_range);
+}
+
+TEST(vectorTest, EraseIf) {
+  vector<int> v;
+  std::vector<int> stdv;
+  for (int i = 0; i < 1000; ++i) v.push_back(i), stdv.push_back(i);
+  auto is_evicted = [](int item) { return item % 3 == 0 || item > 900; };
+  EXPECT_EQ(erase_if(v, is_evicted), 400);
+  stdv.erase(std::remove_if(stdv.begin(), stdv.end(), is_evicted), stdv.end());
+  ExpectSameElements(v, stdv);
+  EXPECT_EQ(erase(v, 1), 1);
+  EXPECT_EQ(v[0], 2);
+  EXPECT_EQ(v.remove_if([](int) { return false; }), 0);
+  EXPECT_EQ(v.size(), 599);
+}
+
+TEST(vectorTest, RemoveIfTestsEachElementOnce) {
+  vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  vector<int> seen;
+  // Removes runs of three, keeps runs of four.
+  auto in_removed_run = [&seen, calls = 0](int item) mutable {
+    seen.push_back(item);
+    return calls++ % 7 < 3;
+  };
+  EXPECT_EQ(v.remove_if(in_removed_run), 44);
+  ASSERT_EQ(seen.size(), 100);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(seen[i], i);
+  ASSERT_EQ(v.size(), 56);
+  EXPECT_EQ(v[0], 3);
+  EXPECT_EQ(v[4], 10);
+  EXPECT_EQ(v[55], 97);
+}
+
+TEST(vectorTest, RemoveIfDestroysTail) {
+  Tracked::Reset();
+  {
+    vector<Tracked> v;
+    for (int i = 0; i < 10; ++i) v.emplace_back(i);
+    v.remove_if([](const Tracked &item) { return item.value % 2; });
+    EXPECT_EQ(Tracked::alive, 5);
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i].value, i * 2);
+  }
+  EXPECT_EQ(Tracked::alive, 0);
+}
+
+TEST(vectorTest, Resize) {
+  vector<std::string> v{"a"};
+  std::vector<std::string> stdv{"a"};
+  v.resize(3);
+  stdv.resize(3);
+  ExpectSameElements(v, stdv);
+  v.resize(5, v[0]);
+  stdv.resize(5, stdv[0]);
+  ExpectSameElements(v, stdv);
+  v.resize(2);
+  stdv.resize(2);
+  ExpectSameElements(v, stdv);
+  EXPECT_EQ(v.capacity(), 6);
+  EXPECT_THROW(v.resize(v.max_size() + 1), std::length_error);
+}
+
+TEST(vectorTest, ResizeDestroys) {
+  Tracked::Reset();
+  vector<Tracked> v;
+  v.resize(10, Tracked(3));
+  EXPECT_EQ(Tracked::alive, 10);
+  v.resize(4);
+  EXPECT_EQ(Tracked::alive, 4);
+  EXPECT_EQ(v[3].value, 3);
+  v.resize_for_overwrite(6);
+  EXPECT_EQ(Tracked::alive, 6);
+  EXPECT_EQ(v[5].value, 0);
+}
+
+TEST(vectorTest, ResizeForOverwrite) {
+  vector<char> v;
+  const char text[] = "decoded";
+  v.resize_for_overwrite(sizeof(text));
+  EXPECT_EQ(v.size(), sizeof(text));
+  std::memcpy(v.data(), text, sizeof(text));
+  EXPECT_STREQ(v.data(), "decoded");
+  v.resize_for_overwrite(3);
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v.back(), 'c');
+}
+
+TEST(vectorTest, CheckPolicies) {
+  vector<int> checked{1, 2, 3};
+  EXPECT_THROW(checked.at(3), std::out_of_range);
+  EXPECT_EQ(checked[2], 3);
+
+  vector<int, std::allocator<int>, growth::doubling, check::unchecked> fast{
+      1, 2, 3};
+  EXPECT_EQ(fast.at(1), 2);
+  EXPECT_EQ(fast.back(), 3);
+
+  vector<int, std::allocator<int>, growth::doubling, check::debug> debug{1, 2};
+  debug.front() = 5;
+  EXPECT_EQ(debug.at(0), 5);
+
+  vector<int, std::allocator<int>, growth::doubling, check::expected> soft{1};
+  auto found = soft.at(0);
+  ASSERT_TRUE(found.has_value());
+  *found = 10;
+  EXPECT_EQ(soft[0], 10);
+  auto missing = soft.at(1);
+  EXPECT_FALSE(missing);
+  EXPECT_EQ(missing.error(), access_error::out_of_range);
+  EXPECT_THROW(missing.value(), std::out_of_range);
+  soft.pop_back();
+  EXPECT_EQ(soft.front().error(), access_error::empty);
+  int fallback = -1;
+  EXPECT_EQ(soft.back().value_or(fallback), -1);
+}
+
+template <typename T>
+void ExpectScansMatchStd() {
+  // Sizes around every register width exercise the scalar tails.
+  for (std::size_t size = 0; size < 70; ++size) {
+    vector<T> v;
+    for (std::size_t i = 0; i < size; ++i) v.push_back(T((i * 37) % 101));
+    std::vector<T> expected(v.begin(), v.end());
+
+    EXPECT_EQ(v.find(T(50)) - v.begin(),
+              std::find(expected.begin(), expected.end(), T(50)) -
+                  expected.begin());
+    EXPECT_EQ(v.count(T(3)),
+              std::count(expected.begin(), expected.end(), T(3)));
+    EXPECT_EQ(v.contains(T(100)), size > 30);
+    detail::simd::SumType<T> sum = 0;
+    for (T item : expected) sum += item;
+    EXPECT_EQ(v.sum(), sum);
+    if (size == 0) continue;
+    EXPECT_EQ(&v.min(), &v[std::min_element(expected.begin(), expected.end()) -
+                           expected.begin()]);
+    EXPECT_EQ(&v.max(), &v[std::max_element(expected.begin(), expected.end()) -
+                           expected.begin()]);
+  }
+}
+
+// Every dispatch level this build and CPU can run, the plain loops first.
+std::vector<detail::simd::Level> SimdLevels() {
+  using detail::simd::Level;
+  std::vector<Level> levels;
+  for (Level level :
+       {Level::kScalar, Level::kSse2, Level::kAvx2, Level::kAvx512})
+    if (level <= detail::simd::DetectLevel()) levels.push_back(level);
+  return levels;
+}
+
+TEST(vectorTest, SimdScans) {
+  for (detail::simd::Level level : SimdLevels()) {
+    SCOPED_TRACE("level " + std::to_string(int(level)));
+    detail::simd::ScopedLevel forced(level);
+    ASSERT_EQ(detail::simd::ActiveLevel(), level);
+    ExpectScansMatchStd<int32_t>();
+    ExpectScansMatchStd<uint64_t>();
+    ExpectScansMatchStd<float>();
+    ExpectScansMatchStd<double>();
+    ExpectScansMatchStd<short>();
+  }
+  EXPECT_EQ(detail::simd::ActiveLevel(), detail::simd::DetectLevel());
+}
+
+void ExpectScanEdgeCases() {
+  vector<int> empty;
+  EXPECT_EQ(empty.find(1), empty.end());
+  EXPECT_EQ(empty.count(1), 0);
+  EXPECT_THROW(empty.min(), std::out_of_range);
+  EXPECT_THROW(empty.max(), std::out_of_range);
+
+  vector<int> counted;
+  counted.resize(100000, 7);
+  counted[99999] = 8;
+  EXPECT_EQ(counted.count(7), 99999);
+  EXPECT_EQ(*counted.find(8), 8);
+  EXPECT_EQ(counted.sum(), 700001);
+
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  vector<double> floats{3.0, nan, -1.0, 2.0, 5.0, nan, -1.0, 0.5, 4.0};
+  EXPECT_EQ(floats.min(), -1.0);
+  EXPECT_EQ(&floats.min(), &floats[2]);
+  EXPECT_EQ(floats.max(), 5.0);
+  EXPECT_EQ(floats.count(nan), 0);
+
+  vector<std::string> words{"a", "b", "a"};
+  EXPECT_EQ(words.find("b") - words.begin(), 1);
+  EXPECT_EQ(words.count("a"), 2);
+  EXPECT_EQ(words.min(), "a");
+  EXPECT_EQ(words.max(), "b");
+}
+
+TEST(vectorTest, SimdScanEdgeCases) {
+  for (detail::simd::Level level : SimdLevels()) {
+    SCOPED_TRACE("level " + std::to_string(int(level)));
+    detail::simd::ScopedLevel forced(level);
+    ExpectScanEdgeCases();
+  }
+}
+
+TEST(vectorTest, AlignedVector) {
+  aligned_vector<float, 32> floats;
+  for (int i = 0; i < 1000; ++i) {
+    floats.push_back(float(i));
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(floats.data()) % 32, 0);
+  }
+  floats.shrink_to_fit();
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(floats.data()) % 32, 0);
+  EXPECT_EQ(floats.sum(), 499500.0);
+
+  aligned_vector<char> bytes(3);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(bytes.data()) % 64, 0);
+  aligned_vector<char> copy(bytes);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(copy.data()) % 64, 0);
+
+  static_assert(sizeof(cache_padded<int>) == kCacheLineBytes);
+  vector<cache_padded<int>> slots(4);
+  for (int i = 0; i < 4; ++i) *slots[i] = i;
+  EXPECT_EQ(reinterpret_cast<char *>(&slots[1].value) -
+                reinterpret_cast<char *>(&slots[0].value),
+            64);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(slots.data()) % 64, 0);
+  EXPECT_EQ(slots.back().value, 3);
+}
+
+TEST(vectorTest, BoolIsPacked) {
+  vector<bool> flags(1000, true);
+  EXPECT_EQ(flags.size(), 1000);
+  EXPECT_EQ(flags.word_count(), 16);
+  EXPECT_GE(flags.capacity(), 1000);
+  EXPECT_EQ(flags.count(), 1000);
+  flags[3] = false;
+  flags.at(999) = false;
+  EXPECT_FALSE(flags[3]);
+  EXPECT_FALSE(flags.back());
+  EXPECT_TRUE(flags.front());
+  EXPECT_EQ(flags.count(false), 2);
+  EXPECT_THROW(flags.at(1000), std::out_of_range);
+
+  vector<bool> copy = flags;
+  copy[0].flip();
+  EXPECT_TRUE(flags[0]);
+  EXPECT_FALSE(copy[0]);
+  swap(copy[0], copy[1]);
+  EXPECT_TRUE(copy[0]);
+  EXPECT_FALSE(copy[1]);
+
+  const vector<bool> &view = flags;
+  EXPECT_EQ(std::count(view.begin(), view.end(), true), 998);
+  EXPECT_EQ(view.end() - view.begin(), 1000);
+}
+
+TEST(vectorTest, BoolMatchesStd) {
+  vector<bool> bits;
+  std::vector<bool> expected;
+  for (int i = 0; i < 300; ++i) {
+    bool value = (i * 7) % 5 < 2;
+    bits.push_back(value);
+    expected.push_back(value);
+  }
+  for (int i : {0, 63, 64, 65, 127, 250}) {
+    bits.insert(bits.begin() + i, true);
+    expected.insert(expected.begin() + i, true);
+  }
+  for (int i : {0, 64, 63, 128, 200, 299}) {
+    bits.erase(bits.begin() + i);
+    expected.erase(expected.begin() + i);
+  }
+  bits.pop_back();
+  expected.pop_back();
+  bits.resize(330, true);
+  expected.resize(330, true);
+  bits.resize(310);
+  expected.resize(310);
+
+  ASSERT_EQ(bits.size(), expected.size());
+  EXPECT_TRUE(std::equal(bits.begin(), bits.end(), expected.begin()));
+  EXPECT_EQ(bits.count(), std::count(expected.begin(), expected.end(), true));
+
+  std::size_t found = 0;
+  for (std::size_t i = bits.find_first(); i != vector<bool>::npos;
+       i = bits.find_next(i), ++found)
+    EXPECT_TRUE(expected[i]);
+  EXPECT_EQ(found, bits.count());
+}
+
+TEST(vectorTest, BoolWordOperations) {
+  vector<bool> a(130);
+  vector<bool> b(130);
+  EXPECT_EQ(a.find_first(), vector<bool>::npos);
+  EXPECT_TRUE(a.none());
+  a[1] = a[64] = a[129] = true;
+  b[64] = b[100] = true;
+  EXPECT_EQ(a.find_first(), 1);
+  EXPECT_EQ(a.find_next(1), 64);
+  EXPECT_EQ(a.find_next(64), 129);
+  EXPECT_EQ(a.find_next(129), vector<bool>::npos);
+  EXPECT_EQ(a.find_next(vector<bool>::npos), vector<bool>::npos);
+  EXPECT_EQ(a.find_next(a.size()), vector<bool>::npos);
+
+  vector<bool> both = a & b;
+  EXPECT_EQ(both.count(), 1);
+  EXPECT_TRUE(both[64]);
+  EXPECT_EQ((a | b).count(), 4);
+  EXPECT_EQ((a ^ b).count(), 3);
+  EXPECT_EQ((~a).count(), 127);
+  a.flip();
+  EXPECT_EQ(a.count(), 127);
+  EXPECT_EQ(a, ~~a);
+  EXPECT_NE(a, b);
+  a.flip(0);
+  EXPECT_EQ(a.find_first(), 2);
+
+  vector<bool> all_set(64, true);
+  EXPECT_TRUE(all_set.all());
+  EXPECT_THROW(a &= all_set, std::length_error);
+  EXPECT_THROW(vector<bool>().pop_back(), std::length_error);
+}
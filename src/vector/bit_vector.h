@@ -0,0 +1,573 @@
+#ifndef CPP2_S21_CONTAINERS_VECTOR_BIT_VECTOR_H_
+#define CPP2_S21_CONTAINERS_VECTOR_BIT_VECTOR_H_
+
+// Packed vector<bool>, included at the end of s21_vector.h.
+#include "../s21_vector.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+
+using BitWord = std::uint64_t;
+
+inline constexpr std::size_t kBitsPerWord = 64;
+
+constexpr std::size_t WordsFor(std::size_t bits) noexcept {
+  return (bits + kBitsPerWord - 1) / kBitsPerWord;
+}
+
+constexpr BitWord BitMask(std::size_t pos) noexcept {
+  return BitWord(1) << (pos % kBitsPerWord);
+}
+
+// Mask of the bits below pos within its word.
+constexpr BitWord LowBits(std::size_t pos) noexcept {
+  return BitMask(pos) - 1;
+}
+
+inline std::size_t CountBitsScalar(const BitWord *words, std::size_t count) {
+  std::size_t bits = 0;
+  for (std::size_t i = 0; i < count; ++i)
+    bits += __builtin_popcountll(words[i]);
+  return bits;
+}
+
+#if S21_SIMD_X86
+// Without -mpopcnt GCC expands __builtin_popcountll to a bit-twiddling
+// sequence, so the popcnt instruction is enabled here and picked at runtime.
+__attribute__((target("popcnt"))) inline std::size_t CountBitsPopcnt(
+    const BitWord *words, std::size_t count) {
+  std::size_t bits = 0;
+  for (std::size_t i = 0; i < count; ++i)
+    bits += __builtin_popcountll(words[i]);
+  return bits;
+}
+#endif  // S21_SIMD_X86
+
+inline std::size_t CountBits(const BitWord *words, std::size_t count) {
+#if S21_SIMD_X86
+  static const bool has_popcnt = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt") != 0;
+  }();
+  if (has_popcnt) return CountBitsPopcnt(words, count);
+#endif  // S21_SIMD_X86
+  return CountBitsScalar(words, count);
+}
+
+// Proxy returned by the mutable element access of vector<bool>.
+class BitReference {
+ public:
+  constexpr BitReference(BitWord *word, BitWord mask) noexcept
+      : word_(word), mask_(mask) {}
+
+  constexpr BitReference(const BitReference &) noexcept = default;
+
+  constexpr operator bool() const noexcept { return *word_ & mask_; }
+
+  constexpr bool operator~() const noexcept { return !bool(*this); }
+
+  constexpr BitReference &operator=(bool value) noexcept {
+    if (value)
+      *word_ |= mask_;
+    else
+      *word_ &= ~mask_;
+    return *this;
+  }
+
+  constexpr BitReference &operator=(const BitReference &other) noexcept {
+    return *this = bool(other);
+  }
+
+  constexpr void flip() noexcept { *word_ ^= mask_; }
+
+  friend constexpr void swap(BitReference a, BitReference b) noexcept {
+    bool tmp = a;
+    a = bool(b);
+    b = tmp;
+  }
+
+ private:
+  BitWord *word_;
+  BitWord mask_;
+};
+
+template <bool IsConst>
+class BitIterator {
+  using word_pointer = std::conditional_t<IsConst, const BitWord *, BitWord *>;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bool;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::conditional_t<IsConst, bool, BitReference>;
+  using pointer = void;
+
+  constexpr BitIterator() noexcept = default;
+
+  constexpr BitIterator(word_pointer words, std::size_t pos) noexcept
+      : words_(words), pos_(pos) {}
+
+  // iterator converts to const_iterator.
+  template <bool C = IsConst, typename = std::enable_if_t<C>>
+  constexpr BitIterator(const BitIterator<false> &other) noexcept
+      : words_(other.words_), pos_(other.pos_) {}
+
+  constexpr reference operator*() const noexcept {
+    if constexpr (IsConst)
+      return words_[pos_ / kBitsPerWord] & BitMask(pos_);
+    else
+      return BitReference(words_ + pos_ / kBitsPerWord, BitMask(pos_));
+  }
+
+  constexpr reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  constexpr BitIterator &operator++() noexcept {
+    ++pos_;
+    return *this;
+  }
+
+  constexpr BitIterator operator++(int) noexcept {
+    BitIterator old = *this;
+    ++pos_;
+    return old;
+  }
+
+  constexpr BitIterator &operator--() noexcept {
+    --pos_;
+    return *this;
+  }
+
+  constexpr BitIterator operator--(int) noexcept {
+    BitIterator old = *this;
+    --pos_;
+    return old;
+  }
+
+  constexpr BitIterator &operator+=(difference_type n) noexcept {
+    pos_ += n;
+    return *this;
+  }
+
+  constexpr BitIterator &operator-=(difference_type n) noexcept {
+    pos_ -= n;
+    return *this;
+  }
+
+  friend constexpr BitIterator operator+(BitIterator it,
+                                         difference_type n) noexcept {
+    return it += n;
+  }
+
+  friend constexpr BitIterator operator+(difference_type n,
+                                         BitIterator it) noexcept {
+    return it += n;
+  }
+
+  friend constexpr BitIterator operator-(BitIterator it,
+                                         difference_type n) noexcept {
+    return it -= n;
+  }
+
+  friend constexpr difference_type operator-(const BitIterator &a,
+                                             const BitIterator &b) noexcept {
+    return difference_type(a.pos_) - difference_type(b.pos_);
+  }
+
+  friend constexpr bool operator==(const BitIterator &a,
+                                   const BitIterator &b) noexcept {
+    return a.pos_ == b.pos_;
+  }
+
+  friend constexpr bool operator!=(const BitIterator &a,
+                                   const BitIterator &b) noexcept {
+    return a.pos_ != b.pos_;
+  }
+
+  friend constexpr bool operator<(const BitIterator &a,
+                                  const BitIterator &b) noexcept {
+    return a.pos_ < b.pos_;
+  }
+
+  friend constexpr bool operator>(const BitIterator &a,
+                                  const BitIterator &b) noexcept {
+    return a.pos_ > b.pos_;
+  }
+
+  friend constexpr bool operator<=(const BitIterator &a,
+                                   const BitIterator &b) noexcept {
+    return a.pos_ <= b.pos_;
+  }
+
+  friend constexpr bool operator>=(const BitIterator &a,
+                                   const BitIterator &b) noexcept {
+    return a.pos_ >= b.pos_;
+  }
+
+ private:
+  template <bool>
+  friend class BitIterator;
+
+  word_pointer words_ = nullptr;
+  std::size_t pos_ = 0;
+};
+
+}  // namespace detail
+
+// Packs one element per bit into 64-bit words. Element access goes through
+// the BitReference proxy, bulk queries (count, find_first, find_next) and the
+// bitwise operators work a word at a time. Bits of the last word past size()
+// are kept clear.
+//
+// at(), front() and back() run CheckPolicy::Check, but a proxy can't be
+// wrapped in an access_result, so check::expected throws like
+// check::throwing here.
+template <typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+class vector<bool, Allocator, GrowthPolicy, CheckPolicy> {
+  using word_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<detail::BitWord>;
+  using words_type = vector<detail::BitWord, word_allocator, GrowthPolicy>;
+
+ public:
+  using value_type = bool;
+  using allocator_type = Allocator;
+  using word_type = detail::BitWord;
+  using reference = detail::BitReference;
+  using const_reference = bool;
+  using iterator = detail::BitIterator<false>;
+  using const_iterator = detail::BitIterator<true>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+  static constexpr size_type bits_per_word = detail::kBitsPerWord;
+
+  // Member functions
+ public:
+  vector() {}
+
+  explicit vector(const allocator_type &alloc)
+      : words_(word_allocator(alloc)) {}
+
+  explicit vector(size_type size, bool value = false,
+                  const allocator_type &alloc = allocator_type())
+      : words_(word_allocator(alloc)) {
+    resize(size, value);
+  }
+
+  vector(std::initializer_list<bool> const &items,
+         const allocator_type &alloc = allocator_type())
+      : words_(word_allocator(alloc)) {
+    reserve(items.size());
+    for (bool item : items) push_back(item);
+  }
+
+  vector(const vector &v) = default;
+
+  vector(vector &&v) noexcept
+      : words_(std::move(v.words_)), size_(std::exchange(v.size_, 0)) {}
+
+  vector &operator=(const vector &v) = default;
+
+  vector &operator=(vector &&v) noexcept {
+    words_ = std::move(v.words_);
+    size_ = std::exchange(v.size_, 0);
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(words_.get_allocator());
+  }
+
+  // Element Access
+ public:
+  reference at(size_type pos) {
+    CheckIndex(pos < size_, "s21::vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    CheckIndex(pos < size_, "s21::vector::at The index is out of range");
+    return (*this)[pos];
+  }
+
+  // Never checked, use at() for checked access.
+  reference operator[](size_type pos) noexcept {
+    return reference(Word(pos), detail::BitMask(pos));
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return words_[pos / bits_per_word] & detail::BitMask(pos);
+  }
+
+  reference front() {
+    CheckIndex(size_ != 0,
+               "s21::vector::front Using methods on a zero sized container "
+               "results in the UB");
+    return (*this)[0];
+  }
+
+  const_reference front() const {
+    CheckIndex(size_ != 0,
+               "s21::vector::front Using methods on a zero sized container "
+               "results in the UB");
+    return (*this)[0];
+  }
+
+  reference back() {
+    CheckIndex(size_ != 0,
+               "s21::vector::back Using methods on a zero sized container "
+               "results in the UB");
+    return (*this)[size_ - 1];
+  }
+
+  const_reference back() const {
+    CheckIndex(size_ != 0,
+               "s21::vector::back Using methods on a zero sized container "
+               "results in the UB");
+    return (*this)[size_ - 1];
+  }
+
+  // The packed words, bit i of the vector being bit i % 64 of word i / 64.
+  word_type *data() noexcept { return words_.data(); }
+
+  const word_type *data() const noexcept { return words_.data(); }
+
+  size_type word_count() const noexcept { return words_.size(); }
+
+  // Iterators
+  iterator begin() noexcept { return iterator(words_.data(), 0); }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(words_.data(), 0);
+  }
+
+  iterator end() noexcept { return iterator(words_.data(), size_); }
+
+  const_iterator end() const noexcept {
+    return const_iterator(words_.data(), size_);
+  }
+
+  // Bit operations
+ public:
+  // Number of set bits, or of clear ones for count(false).
+  size_type count(bool value = true) const noexcept {
+    size_type ones = detail::CountBits(words_.data(), words_.size());
+    return value ? ones : size_ - ones;
+  }
+
+  bool any() const noexcept { return find_first() != npos; }
+
+  bool none() const noexcept { return !any(); }
+
+  bool all() const noexcept { return count() == size_; }
+
+  // Index of the first set bit, npos if there is none.
+  size_type find_first() const noexcept { return FindFrom(0, ~word_type(0)); }
+
+  // Index of the first set bit after pos, npos if there is none.
+  size_type find_next(size_type pos) const noexcept {
+    // Checked before the increment, which would wrap npos around to 0.
+    if (pos >= size_ || ++pos == size_) return npos;
+    return FindFrom(pos / bits_per_word, ~detail::LowBits(pos));
+  }
+
+  void flip() noexcept {
+    for (word_type &word : words_) word = ~word;
+    ClearPadding();
+  }
+
+  void flip(size_type pos) noexcept { (*this)[pos].flip(); }
+
+  // The bitwise operators combine vectors of equal size and throw
+  // std::length_error otherwise.
+  vector &operator&=(const vector &other) {
+    CheckSameSize(other);
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] &= other.words_[i];
+    return *this;
+  }
+
+  vector &operator|=(const vector &other) {
+    CheckSameSize(other);
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] |= other.words_[i];
+    return *this;
+  }
+
+  vector &operator^=(const vector &other) {
+    CheckSameSize(other);
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] ^= other.words_[i];
+    return *this;
+  }
+
+  friend vector operator&(vector lhs, const vector &rhs) {
+    return lhs &= rhs;
+  }
+
+  friend vector operator|(vector lhs, const vector &rhs) {
+    return lhs |= rhs;
+  }
+
+  friend vector operator^(vector lhs, const vector &rhs) {
+    return lhs ^= rhs;
+  }
+
+  friend vector operator~(vector v) {
+    v.flip();
+    return v;
+  }
+
+  friend bool operator==(const vector &lhs, const vector &rhs) noexcept {
+    if (lhs.size_ != rhs.size_) return false;
+    for (size_type i = 0; i < lhs.words_.size(); ++i)
+      if (lhs.words_[i] != rhs.words_[i]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const vector &lhs, const vector &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+
+  // Capacity
+ public:
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return words_.max_size() / 2 * bits_per_word;
+  }
+
+  void reserve(size_type new_cap) {
+    if (new_cap > max_size())
+      throw std::length_error(
+          "s21::vector::reserve Reserve capacity can't be larger than "
+          "max_size()");
+    words_.reserve(detail::WordsFor(new_cap));
+  }
+
+  size_type capacity() const noexcept {
+    return words_.capacity() * bits_per_word;
+  }
+
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  // Modifiers
+ public:
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  void resize(size_type count, bool value = false) {
+    if (count > max_size())
+      throw std::length_error(
+          "s21::vector::resize Size can't be larger than max_size()");
+    if (count > size_ && value) {
+      if (size_ % bits_per_word) *Word(size_) |= ~detail::LowBits(size_);
+      words_.resize(detail::WordsFor(count), ~word_type(0));
+    } else {
+      words_.resize(detail::WordsFor(count));
+    }
+    size_ = count;
+    ClearPadding();
+  }
+
+  iterator insert(const_iterator pos, bool value) {
+    size_type index = pos - begin();
+    if (index > size_)
+      throw std::out_of_range(
+          "s21::vector::insert Unable to insert into a position out of range "
+          "of begin() to end()");
+
+    push_back(false);
+    // Every bit from index on moves up by one, carrying across words.
+    size_type first = index / bits_per_word;
+    for (size_type i = words_.size() - 1; i > first; --i)
+      words_[i] = words_[i] << 1 | words_[i - 1] >> (bits_per_word - 1);
+    word_type low = detail::LowBits(index);
+    words_[first] = (words_[first] & low) | (words_[first] & ~low) << 1;
+    (*this)[index] = value;
+    return begin() + index;
+  }
+
+  iterator erase(const_iterator pos) {
+    size_type index = pos - begin();
+    if (index >= size_)
+      throw std::out_of_range(
+          "s21::vector::erase Unable to erase a position out of range of "
+          "begin() to end()");
+
+    size_type first = index / bits_per_word;
+    word_type low = detail::LowBits(index);
+    words_[first] = (words_[first] & low) | (words_[first] >> 1 & ~low);
+    for (size_type i = first; i + 1 < words_.size(); ++i) {
+      words_[i] |= words_[i + 1] << (bits_per_word - 1);
+      words_[i + 1] >>= 1;
+    }
+    pop_back();
+    return begin() + index;
+  }
+
+  void push_back(bool value) {
+    if (size_ % bits_per_word == 0) words_.push_back(0);
+    ++size_;
+    (*this)[size_ - 1] = value;
+  }
+
+  void pop_back() {
+    if (size_ == 0)
+      throw std::length_error(
+          "s21::vector::pop_back Calling pop_back on an empty container "
+          "results in UB");
+    resize(size_ - 1);
+  }
+
+  void swap(vector &other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  words_type words_;
+  size_type size_ = 0;
+
+  word_type *Word(size_type pos) noexcept {
+    return words_.data() + pos / bits_per_word;
+  }
+
+  static void CheckIndex(bool valid, const char *message) {
+    if (!CheckPolicy::Check(valid)) throw std::out_of_range(message);
+  }
+
+  void CheckSameSize(const vector &other) const {
+    if (size_ != other.size_)
+      throw std::length_error(
+          "s21::vector Bitwise operations need vectors of the same size");
+  }
+
+  void ClearPadding() noexcept {
+    if (size_ % bits_per_word) words_.back() &= detail::LowBits(size_);
+  }
+
+  // Scans from word first, whose bits outside mask are ignored.
+  size_type FindFrom(size_type first, word_type mask) const noexcept {
+    for (size_type i = first; i < words_.size(); ++i, mask = ~word_type(0)) {
+      word_type word = words_[i] & mask;
+      if (word) return i * bits_per_word + __builtin_ctzll(word);
+    }
+    return npos;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_VECTOR_BIT_VECTOR_H_
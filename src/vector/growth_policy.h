@@ -0,0 +1,90 @@
+#ifndef CPP2_S21_CONTAINERS_VECTOR_GROWTH_POLICY_H_
+#define CPP2_S21_CONTAINERS_VECTOR_GROWTH_POLICY_H_
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+namespace growth {
+
+// A growth policy decides how much memory s21::vector asks for:
+//   Grow(capacity, required, value_size) - new capacity once required elements
+//     no longer fit into capacity, never less than required;
+//   Fit(size, value_size) - capacity shrink_to_fit() should end up with.
+
+// Buffers of at least this many bytes are considered large.
+inline constexpr std::size_t kLargeBufferBytes = std::size_t(1) << 21;
+
+inline constexpr std::size_t kPageBytes = 4096;
+
+// Rounds count elements of value_size bytes up to a whole number of pages.
+constexpr std::size_t RoundToPages(std::size_t count, std::size_t value_size,
+                                   std::size_t page = kPageBytes) noexcept {
+  std::size_t bytes = (count * value_size + page - 1) / page * page;
+  return std::max(count, bytes / value_size);
+}
+
+struct doubling {
+  static constexpr std::size_t Grow(std::size_t capacity, std::size_t required,
+                                    std::size_t) noexcept {
+    return std::max(required, capacity ? capacity * 2 : 1);
+  }
+
+  static constexpr std::size_t Fit(std::size_t size, std::size_t) noexcept {
+    return size;
+  }
+};
+
+// Grows by half of the capacity, which lets freed blocks be reused by the
+// allocator for later, larger buffers.
+struct one_and_half {
+  static constexpr std::size_t Grow(std::size_t capacity, std::size_t required,
+                                    std::size_t) noexcept {
+    return std::max(required, capacity + capacity / 2 + 1);
+  }
+
+  static constexpr std::size_t Fit(std::size_t size, std::size_t) noexcept {
+    return size;
+  }
+};
+
+// Doubles and rounds up to whole pages so no allocated byte goes unused.
+template <std::size_t PageBytes = kPageBytes>
+struct page_rounded {
+  static constexpr std::size_t Grow(std::size_t capacity, std::size_t required,
+                                    std::size_t value_size) noexcept {
+    return RoundToPages(doubling::Grow(capacity, required, value_size),
+                        value_size, PageBytes);
+  }
+
+  static constexpr std::size_t Fit(std::size_t size,
+                                   std::size_t value_size) noexcept {
+    return size ? RoundToPages(size, value_size, PageBytes) : 0;
+  }
+};
+
+// For vectors that reach gigabytes: doubles while small, then grows by half
+// in whole pages. Paired with s21::remap_allocator, trivially copyable
+// elements are never copied on growth: large buffers are resized in place
+// with mremap (see s21::large_vector).
+template <std::size_t LargeBytes = kLargeBufferBytes>
+struct large_buffer {
+  static constexpr std::size_t Grow(std::size_t capacity, std::size_t required,
+                                    std::size_t value_size) noexcept {
+    if (capacity * value_size < LargeBytes)
+      return doubling::Grow(capacity, required, value_size);
+    return RoundToPages(one_and_half::Grow(capacity, required, value_size),
+                        value_size);
+  }
+
+  static constexpr std::size_t Fit(std::size_t size,
+                                   std::size_t value_size) noexcept {
+    if (size * value_size < LargeBytes) return size;
+    return RoundToPages(size, value_size);
+  }
+};
+
+}  // namespace growth
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_VECTOR_GROWTH_POLICY_H_
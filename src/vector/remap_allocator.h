@@ -0,0 +1,111 @@
+#ifndef CPP2_S21_CONTAINERS_VECTOR_REMAP_ALLOCATOR_H_
+#define CPP2_S21_CONTAINERS_VECTOR_REMAP_ALLOCATOR_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+
+namespace s21 {
+
+// Allocator that serves blocks of at least LargeBytes bytes straight from
+// anonymous mappings and everything smaller from the heap. Its reallocate()
+// grows a mapped block with mremap on Linux: the kernel moves page table
+// entries instead of copying the data, so it is meant for trivially copyable
+// element types only.
+template <typename T, std::size_t LargeBytes = growth::kLargeBufferBytes>
+class remap_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  template <typename U>
+  struct rebind {
+    using other = remap_allocator<U, LargeBytes>;
+  };
+
+  remap_allocator() noexcept {}
+
+  template <typename U>
+  remap_allocator(const remap_allocator<U, LargeBytes> &) noexcept {}
+
+  T *allocate(size_type count) {
+    if (!IsMapped(count)) return std::allocator<T>().allocate(count);
+
+    void *block = mmap(nullptr, MappedBytes(count), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (block == MAP_FAILED) throw std::bad_alloc();
+    return static_cast<T *>(block);
+  }
+
+  void deallocate(T *block, size_type count) noexcept {
+    if (IsMapped(count))
+      munmap(block, MappedBytes(count));
+    else
+      std::allocator<T>().deallocate(block, count);
+  }
+
+  // Resizes a block of old_count elements to new_count, keeping the leading
+  // bytes. Returns the (possibly moved) block.
+  T *reallocate(T *block, size_type old_count, size_type new_count) {
+#ifdef __linux__
+    if (IsMapped(old_count) && IsMapped(new_count)) {
+      void *moved = mremap(block, MappedBytes(old_count),
+                           MappedBytes(new_count), MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) throw std::bad_alloc();
+      return static_cast<T *>(moved);
+    }
+#endif
+    T *moved = allocate(new_count);
+    std::memcpy(static_cast<void *>(moved), block,
+                std::min(old_count, new_count) * sizeof(T));
+    deallocate(block, old_count);
+    return moved;
+  }
+
+  static bool IsMapped(size_type count) noexcept {
+    return count * sizeof(T) >= LargeBytes;
+  }
+
+ private:
+  static size_type MappedBytes(size_type count) noexcept {
+    static const size_type page = sysconf(_SC_PAGESIZE);
+    return (count * sizeof(T) + page - 1) / page * page;
+  }
+};
+
+template <typename T, typename U, std::size_t LargeBytes>
+bool operator==(const remap_allocator<T, LargeBytes> &,
+                const remap_allocator<U, LargeBytes> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U, std::size_t LargeBytes>
+bool operator!=(const remap_allocator<T, LargeBytes> &,
+                const remap_allocator<U, LargeBytes> &) noexcept {
+  return false;
+}
+
+namespace detail {
+
+// Whether Alloc can resize a block in place via reallocate(p, old_n, new_n).
+template <typename Alloc, typename = void>
+inline constexpr bool kHasReallocate = false;
+
+template <typename Alloc>
+inline constexpr bool kHasReallocate<
+    Alloc, std::void_t<decltype(std::declval<Alloc &>().reallocate(
+               std::declval<typename Alloc::value_type *>(), std::size_t(),
+               std::size_t()))>> = true;
+
+}  // namespace detail
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_VECTOR_REMAP_ALLOCATOR_H_